@@ -4,13 +4,19 @@ namespace Dynamo {
     Application::Application(const ApplicationSettings &settings) :
         _display(settings.title, settings.window_width, settings.window_height),
         _renderer(_display, settings.root_asset_directory) {
-        // Run audio on a separate thread
-        _audio_thread = std::thread([&]() {
-            while (is_running()) {
-                _jukebox.update();
-            }
-        });
         _running = true;
+        _jukebox.set_realtime(settings.realtime_audio);
+
+        // Run audio on a separate thread, sleeping until the output device needs more data.
+        // An offline Jukebox is only mixed by render(), so it does not get a thread.
+        if (!settings.realtime_audio && !_jukebox.is_offline()) {
+            _audio_thread = std::thread([&]() {
+                while (is_running()) {
+                    _jukebox.wait();
+                    _jukebox.update();
+                }
+            });
+        }
     }
 
     Application::~Application() {
@@ -38,6 +44,13 @@ namespace Dynamo {
         _display.input().poll();
         _renderer.render();
 
+        // Publish audio state to the output callback or the audio thread
+        if (_jukebox.is_realtime()) {
+            _jukebox.update();
+        } else {
+            _jukebox.commit();
+        }
+
         // Tick
         _clock.tick();
     }
@@ -37,6 +37,12 @@ namespace Dynamo {
          *
          */
         std::string root_asset_directory;
+
+        /**
+         * @brief Mix audio directly in the output callback for lower latency.
+         *
+         */
+        bool realtime_audio = false;
     };
 
     /**
@@ -1,4 +1,5 @@
 #include <Asset/Obj.hpp>
+#include <Utils/FlatMap.hpp>
 #include <rapidobj/rapidobj.hpp>
 
 namespace Dynamo::Asset {
@@ -12,7 +13,7 @@ namespace Dynamo::Asset {
                        result.error.line);
         }
 
-        std::vector<std::unordered_map<Vertex, unsigned>> index_maps;
+        std::vector<FlatMap<Vertex, unsigned>> index_maps;
 
         // No-material group
         groups.push_back({});
@@ -71,16 +72,15 @@ namespace Dynamo::Asset {
                     MeshGroup &group = groups[material_id + 1];
                     auto &index_map = index_maps[material_id + 1];
 
-                    if (!index_map.count(vertex)) {
-                        index_map.emplace(vertex, group.positions.size());
-
+                    auto [index_it, inserted] = index_map.emplace(vertex, group.positions.size());
+                    if (inserted) {
                         // Update vertex arrays
                         group.positions.push_back(vertex.position);
                         group.normals.push_back(vertex.normal);
                         group.uvs.push_back(vertex.uv);
                         group.colors.push_back(vertex.color);
                     }
-                    group.indices.push_back(index_map.at(vertex));
+                    group.indices.push_back(index_it->second);
                 }
             }
         }
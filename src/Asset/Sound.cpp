@@ -1,10 +1,35 @@
 #include <sndfile.hh>
 
 #include <Asset/Sound.hpp>
-#include <Sound/DSP/Resample.hpp>
+#include <Math/Vectorize.hpp>
 #include <Utils/Log.hpp>
 
 namespace Dynamo::Asset {
+    /**
+     * @brief Sound file decoder backed by libsndfile.
+     *
+     */
+    class SndfileDecoder : public Sound::Decoder {
+        SndfileHandle _file;
+
+      public:
+        SndfileDecoder(const std::string filepath) : _file(filepath.c_str(), SFM_READ, 0, 1, 0) {
+            if (_file.error()) {
+                Log::error("Could not open sound file `{}`: {}", filepath, _file.strError());
+            }
+        }
+
+        unsigned channels() const override { return _file.channels(); }
+
+        double sample_rate() const override { return _file.samplerate(); }
+
+        unsigned frames() const override { return _file.frames(); }
+
+        void seek(unsigned frame) override { _file.seek(frame, SEEK_SET); }
+
+        unsigned read(Sound::WaveSample *dst, unsigned frames) override { return _file.readf(dst, frames); }
+    };
+
     Sound::Buffer load_sound(const std::string filepath) {
         SndfileHandle file(filepath.c_str(), SFM_READ, 0, 1, 0);
         if (file.error()) {
@@ -19,21 +44,27 @@ namespace Dynamo::Asset {
         std::vector<Sound::WaveSample> interleaved(frames * channels);
         file.readf(interleaved.data(), interleaved.size());
 
-        // Deinterleave the data
-        Sound::Buffer raw(frames, channels);
-        for (unsigned f = 0; f < frames; f++) {
-            for (unsigned c = 0; c < channels; c++) {
-                raw[c][f] = interleaved[f * channels + c];
-            }
-        }
+        // Deinterleave the data, keeping the native sample rate so the mixer only resamples once
+        Sound::Buffer buffer(frames, channels, sample_rate);
+        Vectorize::vdeinterleave(interleaved.data(), channels, buffer.data(), frames, frames);
+        return buffer;
+    }
 
-        // Resample the signal
-        double scale = Sound::STANDARD_SAMPLE_RATE / sample_rate;
-        Sound::Buffer resampled(frames * scale, channels);
-        for (unsigned c = 0; c < channels; c++) {
-            Sound::resample_signal(raw[c], resampled[c], 0, frames, sample_rate, Sound::STANDARD_SAMPLE_RATE);
+    void save_sound(const std::string filepath, const Sound::Buffer &buffer, double sample_rate) {
+        unsigned frames = buffer.frames();
+        unsigned channels = buffer.channels();
+        SndfileHandle file(filepath.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_FLOAT, channels, sample_rate);
+        if (file.error()) {
+            Log::error("Could not save sound file `{}`: {}", filepath, file.strError());
         }
 
-        return resampled;
+        // Interleave the data
+        std::vector<Sound::WaveSample> interleaved(frames * channels);
+        Vectorize::vinterleave(buffer.data(), frames, channels, interleaved.data(), frames);
+        file.writef(interleaved.data(), frames);
+    }
+
+    std::unique_ptr<Sound::Decoder> open_sound(const std::string filepath) {
+        return std::make_unique<SndfileDecoder>(filepath);
     }
 } // namespace Dynamo::Asset
\ No newline at end of file
@@ -1,13 +1,33 @@
 #pragma once
 
+#include <memory>
+
 #include <Sound/Buffer.hpp>
+#include <Sound/Stream.hpp>
 
 namespace Dynamo::Asset {
     /**
-     * @brief Load a sound file.
+     * @brief Load a sound file at its native sample rate.
      *
      * @param filepath
      * @return Sound::Buffer
      */
     Sound::Buffer load_sound(const std::string filepath);
+
+    /**
+     * @brief Save a sound to a 32-bit floating point WAV file.
+     *
+     * @param filepath
+     * @param buffer
+     * @param sample_rate
+     */
+    void save_sound(const std::string filepath, const Sound::Buffer &buffer, double sample_rate);
+
+    /**
+     * @brief Open a sound file to be decoded incrementally by a Sound::Stream.
+     *
+     * @param filepath
+     * @return std::unique_ptr<Sound::Decoder>
+     */
+    std::unique_ptr<Sound::Decoder> open_sound(const std::string filepath);
 } // namespace Dynamo::Asset
\ No newline at end of file
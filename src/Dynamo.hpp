@@ -19,6 +19,7 @@
 #include <Math/Common.hpp>
 #include <Math/Complex.hpp>
 #include <Math/Delaunay.hpp>
+#include <Math/FFTPlan.hpp>
 #include <Math/Fourier.hpp>
 #include <Math/Mat4.hpp>
 #include <Math/Quaternion.hpp>
@@ -28,24 +29,42 @@
 #include <Math/Vec3.hpp>
 #include <Math/Vectorize.hpp>
 #include <Sound/Buffer.hpp>
+#include <Sound/Bus.hpp>
+#include <Sound/CompressedBuffer.hpp>
+#include <Sound/DSP/Ambisonics.hpp>
+#include <Sound/DSP/BiquadBank.hpp>
 #include <Sound/DSP/Convolver.hpp>
+#include <Sound/DSP/HRIRCache.hpp>
 #include <Sound/DSP/HRTF.hpp>
+#include <Sound/DSP/NonUniformConvolver.hpp>
 #include <Sound/DSP/Resample.hpp>
 #include <Sound/Device.hpp>
 #include <Sound/Filter.hpp>
+#include <Sound/Filters/AmbisonicDecoder.hpp>
+#include <Sound/Filters/AmbisonicEncoder.hpp>
 #include <Sound/Filters/Amplify.hpp>
 #include <Sound/Filters/Binaural.hpp>
+#include <Sound/Filters/Biquad.hpp>
 #include <Sound/Filters/Distance.hpp>
 #include <Sound/Filters/FilterSequence.hpp>
+#include <Sound/Filters/Reverb.hpp>
 #include <Sound/Filters/Stereo.hpp>
 #include <Sound/Jukebox.hpp>
 #include <Sound/Listener.hpp>
 #include <Sound/Source.hpp>
+#include <Sound/Stats.hpp>
+#include <Sound/Stream.hpp>
+#include <Sound/VoiceManager.hpp>
 #include <Utils/Allocator.hpp>
 #include <Utils/Bits.hpp>
+#include <Utils/ConcurrentQueue.hpp>
+#include <Utils/DeadlineScheduler.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/Log.hpp>
 #include <Utils/Random.hpp>
 #include <Utils/RingBuffer.hpp>
 #include <Utils/SparseArray.hpp>
+#include <Utils/StringId.hpp>
 #include <Utils/ThreadPool.hpp>
+#include <Utils/TripleBuffer.hpp>
 #include <Utils/VirtualBuffer.hpp>
\ No newline at end of file
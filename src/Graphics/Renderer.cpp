@@ -184,7 +184,7 @@ namespace Dynamo::Graphics {
 
     void Renderer::destroy_uniforms(UniformGroup group) { _uniforms.destroy(group); }
 
-    std::optional<Uniform> Renderer::get_uniform(UniformGroup group, const std::string &name) {
+    std::optional<Uniform> Renderer::get_uniform(UniformGroup group, StringId name) {
         return _uniforms.find(group, name);
     }
 
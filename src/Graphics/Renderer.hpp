@@ -17,6 +17,7 @@
 #include <Graphics/Vulkan/TextureRegistry.hpp>
 #include <Graphics/Vulkan/UniformRegistry.hpp>
 #include <Math/Color.hpp>
+#include <Utils/StringId.hpp>
 
 namespace Dynamo::Graphics {
     /**
@@ -217,7 +218,7 @@ namespace Dynamo::Graphics {
          * @param name
          * @return std::optional<Uniform>
          */
-        std::optional<Uniform> get_uniform(UniformGroup group, const std::string &name);
+        std::optional<Uniform> get_uniform(UniformGroup group, StringId name);
 
         /**
          * @brief Write to a uniform.
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <unordered_map>
 #include <vector>
 
 #include <Graphics/Vulkan/Context.hpp>
+#include <Utils/FlatMap.hpp>
 #include <vulkan/vulkan_core.h>
 
 namespace Dynamo::Graphics::Vulkan {
@@ -20,7 +20,7 @@ namespace Dynamo::Graphics::Vulkan {
     class DescriptorPool {
         const Context &_context;
 
-        std::unordered_map<VkDescriptorSetLayout, DescriptorPoolCache> _pools;
+        FlatMap<VkDescriptorSetLayout, DescriptorPoolCache> _pools;
 
       public:
         DescriptorPool(const Context &context);
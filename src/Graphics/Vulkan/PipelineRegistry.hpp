@@ -2,7 +2,6 @@
 
 #include <fstream>
 #include <string>
-#include <unordered_map>
 
 #include <vulkan/vulkan_core.h>
 
@@ -12,6 +11,7 @@
 #include <Graphics/Vulkan/Swapchain.hpp>
 #include <Graphics/Vulkan/UniformRegistry.hpp>
 #include <Graphics/Vulkan/Utils.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/SparseArray.hpp>
 
 namespace Dynamo::Graphics::Vulkan {
@@ -113,8 +113,8 @@ namespace Dynamo::Graphics::Vulkan {
         std::ofstream _ofstream;
         VkPipelineCache _pipeline_cache;
 
-        std::unordered_map<PipelineLayoutSettings, VkPipelineLayout, PipelineLayoutSettings::Hash> _layouts;
-        std::unordered_map<GraphicsPipelineSettings, VkPipeline, GraphicsPipelineSettings::Hash> _pipelines;
+        FlatMap<PipelineLayoutSettings, VkPipelineLayout, PipelineLayoutSettings::Hash> _layouts;
+        FlatMap<GraphicsPipelineSettings, VkPipeline, GraphicsPipelineSettings::Hash> _pipelines;
 
         SparseArray<Pipeline, PipelineInstance> _instances;
 
@@ -1,13 +1,13 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <spirv_reflect.h>
 #include <vulkan/vulkan_core.h>
 
 #include <Graphics/Shader.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/SparseArray.hpp>
 
 namespace Dynamo::Graphics::Vulkan {
@@ -81,7 +81,7 @@ namespace Dynamo::Graphics::Vulkan {
     class ShaderRegistry {
         VkDevice _device;
         SparseArray<Shader, ShaderModule> _modules;
-        std::unordered_map<DescriptorSetLayoutKey, VkDescriptorSetLayout, DescriptorSetLayoutKey::Hash> _layouts;
+        FlatMap<DescriptorSetLayoutKey, VkDescriptorSetLayout, DescriptorSetLayoutKey::Hash> _layouts;
 
         std::vector<uint32_t>
         compile(const std::string &name, const std::string &code, VkShaderStageFlagBits stage, bool optimized);
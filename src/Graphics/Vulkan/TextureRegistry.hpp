@@ -1,7 +1,5 @@
 #pragma once
 
-#include <unordered_map>
-
 #include <vulkan/vulkan_core.h>
 
 #include <Graphics/Texture.hpp>
@@ -9,6 +7,7 @@
 #include <Graphics/Vulkan/MemoryPool.hpp>
 #include <Graphics/Vulkan/PhysicalDevice.hpp>
 #include <Graphics/Vulkan/Swapchain.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/SparseArray.hpp>
 
 namespace Dynamo::Graphics::Vulkan {
@@ -58,7 +57,7 @@ namespace Dynamo::Graphics::Vulkan {
         MemoryPool &_memory;
         BufferRegistry &_buffers;
 
-        std::unordered_map<SamplerSettings, VkSampler, SamplerSettings::Hash> _samplers;
+        FlatMap<SamplerSettings, VkSampler, SamplerSettings::Hash> _samplers;
         SparseArray<Texture, TextureInstance> _instances;
 
         void write_texels(const std::vector<unsigned char> &texels,
@@ -21,7 +21,7 @@ namespace Dynamo::Graphics::Vulkan {
         _groups.clear();
     }
 
-    Buffer UniformRegistry::allocate_descriptor_binding(VkDescriptorSet set, const DescriptorBinding &binding) {
+    Buffer UniformRegistry::allocate_descriptor_binding(StringId name, const DescriptorBinding &binding) {
         BufferDescriptor uniform_descriptor;
         uniform_descriptor.size = binding.size * binding.count;
         uniform_descriptor.usage = BufferUsage::Uniform;
@@ -33,7 +33,7 @@ namespace Dynamo::Graphics::Vulkan {
         }
 
         // If shared, find the allocation and increase ref count
-        auto shared_it = _shared_descriptors.find(binding.name);
+        auto shared_it = _shared_descriptors.find(name);
         if (shared_it != _shared_descriptors.end()) {
             shared_it->second.ref_count++;
             return shared_it->second.buffer;
@@ -43,18 +43,18 @@ namespace Dynamo::Graphics::Vulkan {
         SharedDescriptor shared;
         shared.ref_count = 1;
         shared.buffer = _buffers.build(uniform_descriptor);
-        _shared_descriptors.emplace(binding.name, shared);
+        _shared_descriptors.emplace(name, shared);
         return shared.buffer;
     }
 
-    unsigned UniformRegistry::allocate_push_constant_range(const PushConstantRange &range) {
+    unsigned UniformRegistry::allocate_push_constant_range(StringId name, const PushConstantRange &range) {
         // Not shared, allocate a new buffer
         if (!range.shared) {
             return _push_constant_buffer.reserve(range.block.size).value();
         }
 
         // If shared, find the allocation and increase ref count
-        auto shared_it = _shared_push_constants.find(range.name);
+        auto shared_it = _shared_push_constants.find(name);
         if (shared_it != _shared_push_constants.end()) {
             shared_it->second.ref_count++;
             return shared_it->second.offset;
@@ -64,7 +64,7 @@ namespace Dynamo::Graphics::Vulkan {
         SharedPushConstant shared;
         shared.ref_count = 1;
         shared.offset = _push_constant_buffer.reserve(range.block.size).value();
-        _shared_push_constants.emplace(range.name, shared);
+        _shared_push_constants.emplace(name, shared);
         return shared.offset;
     }
 
@@ -117,7 +117,7 @@ namespace Dynamo::Graphics::Vulkan {
 
             for (const DescriptorBinding &binding : layout.bindings) {
                 UniformInstance var;
-                var.name = binding.name;
+                var.name = StringId::intern(binding.name);
                 var.type = UniformType::Descriptor;
                 var.descriptor.type = binding.type;
                 var.descriptor.set = v_set.set;
@@ -127,7 +127,7 @@ namespace Dynamo::Graphics::Vulkan {
 
                 // Allocate uniform buffers
                 if (binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
-                    var.descriptor.buffer = allocate_descriptor_binding(v_set.set, binding);
+                    var.descriptor.buffer = allocate_descriptor_binding(var.name, binding);
                     const BufferInstance &buffer_instance = _buffers.get(var.descriptor.buffer);
                     for (unsigned i = 0; i < binding.count; i++) {
                         VkDescriptorBufferInfo buffer_info;
@@ -147,16 +147,21 @@ namespace Dynamo::Graphics::Vulkan {
                     }
                 }
 
-                group.uniforms.push_back(_uniforms.insert(var));
+                Uniform uniform = _uniforms.insert(var);
+                group.uniforms.push_back(uniform);
+                group.names.emplace(var.name, uniform);
             }
         }
         for (const PushConstantRange &range : push_constant_ranges) {
             UniformInstance var;
-            var.name = range.name;
+            var.name = StringId::intern(range.name);
             var.type = UniformType::PushConstant;
             var.push_constant.size = range.block.size;
-            var.push_constant.offset = allocate_push_constant_range(range);
-            group.uniforms.push_back(_uniforms.insert(var));
+            var.push_constant.offset = allocate_push_constant_range(var.name, range);
+
+            Uniform uniform = _uniforms.insert(var);
+            group.uniforms.push_back(uniform);
+            group.names.emplace(var.name, uniform);
 
             group.push_constant_ranges.push_back(range.block);
             group.push_constant_offsets.push_back(var.push_constant.offset);
@@ -167,13 +172,11 @@ namespace Dynamo::Graphics::Vulkan {
 
     const UniformGroupInstance &UniformRegistry::get(UniformGroup group) const { return _groups.get(group); }
 
-    std::optional<Uniform> UniformRegistry::find(UniformGroup group, const std::string &uniform_name) const {
+    std::optional<Uniform> UniformRegistry::find(UniformGroup group, StringId uniform_name) const {
         const UniformGroupInstance &instance = _groups.get(group);
-        for (const Uniform uniform : instance.uniforms) {
-            const UniformInstance &var = _uniforms.get(uniform);
-            if (var.name == uniform_name) {
-                return uniform;
-            }
+        auto name_it = instance.names.find(uniform_name);
+        if (name_it != instance.names.end()) {
+            return name_it->second;
         }
         return {};
     }
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <unordered_map>
-
 #include <vulkan/vulkan_core.h>
 
 #include <Graphics/Texture.hpp>
@@ -11,7 +9,9 @@
 #include <Graphics/Vulkan/MemoryPool.hpp>
 #include <Graphics/Vulkan/ShaderRegistry.hpp>
 #include <Graphics/Vulkan/TextureRegistry.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/SparseArray.hpp>
+#include <Utils/StringId.hpp>
 #include <Utils/VirtualBuffer.hpp>
 
 namespace Dynamo::Graphics::Vulkan {
@@ -51,6 +51,7 @@ namespace Dynamo::Graphics::Vulkan {
 
     struct UniformGroupInstance {
         std::vector<Uniform> uniforms;
+        FlatMap<StringId, Uniform> names;
         std::vector<VirtualDescriptorSet> v_sets;
         std::vector<VkDescriptorSet> descriptor_sets;
         std::vector<VkPushConstantRange> push_constant_ranges;
@@ -58,7 +59,7 @@ namespace Dynamo::Graphics::Vulkan {
     };
 
     struct UniformInstance {
-        std::string name;
+        StringId name;
         UniformType type;
         union {
             Descriptor descriptor;
@@ -73,15 +74,15 @@ namespace Dynamo::Graphics::Vulkan {
         DescriptorPool &_descriptors;
         VirtualBuffer _push_constant_buffer;
 
-        std::unordered_map<std::string, SharedDescriptor> _shared_descriptors;
-        std::unordered_map<std::string, SharedPushConstant> _shared_push_constants;
+        FlatMap<StringId, SharedDescriptor> _shared_descriptors;
+        FlatMap<StringId, SharedPushConstant> _shared_push_constants;
 
         SparseArray<UniformGroup, UniformGroupInstance> _groups;
         SparseArray<Uniform, UniformInstance> _uniforms;
 
-        Buffer allocate_descriptor_binding(VkDescriptorSet set, const DescriptorBinding &binding);
+        Buffer allocate_descriptor_binding(StringId name, const DescriptorBinding &binding);
 
-        unsigned allocate_push_constant_range(const PushConstantRange &range);
+        unsigned allocate_push_constant_range(StringId name, const PushConstantRange &range);
 
         void free_uniform(const UniformInstance &var);
 
@@ -99,7 +100,7 @@ namespace Dynamo::Graphics::Vulkan {
 
         const UniformGroupInstance &get(UniformGroup group) const;
 
-        std::optional<Uniform> find(UniformGroup group, const std::string &uniform_name) const;
+        std::optional<Uniform> find(UniformGroup group, StringId uniform_name) const;
 
         void *get_push_constant_data(unsigned block_offset);
 
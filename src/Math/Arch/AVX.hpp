@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <immintrin.h>
 
 #include <Math/Arch/SSE.hpp>
@@ -78,4 +79,334 @@ namespace Dynamo::Vectorize::AVX {
         }
         SSE::vclamp(src, lo, hi, dst, rem);
     }
+
+    inline void vconvert_s16(const int16_t *src, const float scalar, float *dst, unsigned length) {
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // Integer operations are limited to 128 bits without AVX2
+            __m128i src_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i lo_v = _mm_srai_epi32(_mm_unpacklo_epi16(src_v, src_v), 16);
+            __m128i hi_v = _mm_srai_epi32(_mm_unpackhi_epi16(src_v, src_v), 16);
+            __m256i int_v = _mm256_insertf128_si256(_mm256_castsi128_si256(lo_v), hi_v, 1);
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(int_v), scalar_v));
+            src += 8;
+            dst += 8;
+        }
+        SSE::vconvert_s16(src, scalar, dst, rem);
+    }
+
+    inline void vconvert_s24(const uint8_t *src, const float scalar, float *dst, unsigned length) {
+        // Move the 3 bytes of each sample into the top of a 32-bit lane, then sign extend
+        __m128i lo_shuffle = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+        __m128i hi_shuffle = _mm_setr_epi8(-1, 4, 5, 6, -1, 7, 8, 9, -1, 10, 11, 12, -1, 13, 14, 15);
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // The second load ends at the last byte of the 8 samples so it never reads past them
+            __m128i lo_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i hi_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8));
+            lo_v = _mm_srai_epi32(_mm_shuffle_epi8(lo_v, lo_shuffle), 8);
+            hi_v = _mm_srai_epi32(_mm_shuffle_epi8(hi_v, hi_shuffle), 8);
+            __m256i int_v = _mm256_insertf128_si256(_mm256_castsi128_si256(lo_v), hi_v, 1);
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(int_v), scalar_v));
+            src += 24;
+            dst += 8;
+        }
+        SSE::vconvert_s24(src, scalar, dst, rem);
+    }
+
+    inline void vconvert_s32(const int32_t *src, const float scalar, float *dst, unsigned length) {
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            __m256i src_v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(src_v), scalar_v));
+            src += 8;
+            dst += 8;
+        }
+        SSE::vconvert_s32(src, scalar, dst, rem);
+    }
+
+    inline __m256i quantize(const float *src, __m256 scalar_v, const float *dither, __m256 lo_v, __m256 hi_v) {
+        __m256 sample_v = _mm256_mul_ps(_mm256_loadu_ps(src), scalar_v);
+        if (dither) {
+            sample_v = _mm256_add_ps(sample_v, _mm256_loadu_ps(dither));
+        }
+        return _mm256_cvtps_epi32(_mm256_max_ps(lo_v, _mm256_min_ps(hi_v, sample_v)));
+    }
+
+    inline void vquantize_s16(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int16_t *dst,
+                              unsigned length) {
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        __m256 lo_v = _mm256_set1_ps(-32768.0f);
+        __m256 hi_v = _mm256_set1_ps(32767.0f);
+        unsigned rem = length % 8;
+        int16_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            __m256i int_v = quantize(src, scalar_v, dither, lo_v, hi_v);
+            __m128i dst_v = _mm_packs_epi32(_mm256_castsi256_si128(int_v), _mm256_extractf128_si256(int_v, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), dst_v);
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 8;
+        }
+        SSE::vquantize_s16(src, scalar, dither, dst, rem);
+    }
+
+    inline void vquantize_s24(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              uint8_t *dst,
+                              unsigned length) {
+        // Pack the low 3 bytes of each 32-bit lane into the first 12 bytes
+        __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        __m256 lo_v = _mm256_set1_ps(-8388608.0f);
+        __m256 hi_v = _mm256_set1_ps(8388607.0f);
+        unsigned rem = length % 8;
+        const float *src_end = src + length - rem;
+        while (src < src_end) {
+            __m256i int_v = quantize(src, scalar_v, dither, lo_v, hi_v);
+            __m128i lo_i = _mm_shuffle_epi8(_mm256_castsi256_si128(int_v), shuffle);
+            __m128i hi_i = _mm_shuffle_epi8(_mm256_extractf128_si256(int_v, 1), shuffle);
+
+            // The padding of the first half is overwritten by the second, which is stored in
+            // 8 and 4 byte parts so nothing is written past the 24 bytes
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), lo_i);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + 12), hi_i);
+            int32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(hi_i, 8));
+            std::memcpy(dst + 20, &tail, sizeof(tail));
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 24;
+        }
+        SSE::vquantize_s24(src, scalar, dither, dst, rem);
+    }
+
+    inline void vquantize_s32(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int32_t *dst,
+                              unsigned length) {
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        __m256 lo_v = _mm256_set1_ps(-2147483648.0f);
+        __m256 hi_v = _mm256_set1_ps(2147483520.0f);
+        unsigned rem = length % 8;
+        int32_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), quantize(src, scalar_v, dither, lo_v, hi_v));
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 8;
+        }
+        SSE::vquantize_s32(src, scalar, dither, dst, rem);
+    }
+
+    inline void vinterleave(const float *src, unsigned stride, unsigned channels, float *dst, unsigned length) {
+        if (channels != 2) {
+            SSE::vinterleave(src, stride, channels, dst, length);
+            return;
+        }
+        unsigned rem = length % 8;
+        unsigned end = length - rem;
+        for (unsigned f = 0; f < end; f += 8) {
+            // Unpacking works within each 128-bit half, so the halves are swapped into place after
+            __m256 l_v = _mm256_loadu_ps(src + f);
+            __m256 r_v = _mm256_loadu_ps(src + stride + f);
+            __m256 lo_v = _mm256_unpacklo_ps(l_v, r_v);
+            __m256 hi_v = _mm256_unpackhi_ps(l_v, r_v);
+            _mm256_storeu_ps(dst + 2 * f, _mm256_permute2f128_ps(lo_v, hi_v, 0x20));
+            _mm256_storeu_ps(dst + 2 * f + 8, _mm256_permute2f128_ps(lo_v, hi_v, 0x31));
+        }
+        SSE::vinterleave(src + end, stride, channels, dst + 2 * end, rem);
+    }
+
+    inline void vdeinterleave(const float *src, unsigned channels, float *dst, unsigned stride, unsigned length) {
+        if (channels != 2) {
+            SSE::vdeinterleave(src, channels, dst, stride, length);
+            return;
+        }
+        unsigned rem = length % 8;
+        unsigned end = length - rem;
+        for (unsigned f = 0; f < end; f += 8) {
+            // Gather frames 0, 1, 4, 5 and 2, 3, 6, 7 so each half shuffles independently
+            __m256 a_v = _mm256_loadu_ps(src + 2 * f);
+            __m256 b_v = _mm256_loadu_ps(src + 2 * f + 8);
+            __m256 lo_v = _mm256_permute2f128_ps(a_v, b_v, 0x20);
+            __m256 hi_v = _mm256_permute2f128_ps(a_v, b_v, 0x31);
+            _mm256_storeu_ps(dst + f, _mm256_shuffle_ps(lo_v, hi_v, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm256_storeu_ps(dst + stride + f, _mm256_shuffle_ps(lo_v, hi_v, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+        SSE::vdeinterleave(src + 2 * end, channels, dst + end, stride, rem);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        __m256 sum_v = _mm256_setzero_ps();
+        unsigned rem = length % 8;
+        const float *src_a_end = src_a + length - rem;
+        while (src_a < src_a_end) {
+            __m256 src_a_v = _mm256_loadu_ps(src_a);
+            __m256 src_b_v = _mm256_loadu_ps(src_b);
+            sum_v = _mm256_fmadd_ps(src_a_v, src_b_v, sum_v);
+            src_a += 8;
+            src_b += 8;
+        }
+        __m128 half_v = _mm_add_ps(_mm256_castps256_ps128(sum_v), _mm256_extractf128_ps(sum_v, 1));
+        return SSE::hsum(half_v) + SSE::vdot(src_a, src_b, rem);
+    }
+
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 8;
+        float *dst_re_end = dst_re + length - rem;
+        while (dst_re < dst_re_end) {
+            __m256 a_re_v = _mm256_loadu_ps(src_a_re);
+            __m256 a_im_v = _mm256_loadu_ps(src_a_im);
+            __m256 b_re_v = _mm256_loadu_ps(src_b_re);
+            __m256 b_im_v = _mm256_loadu_ps(src_b_im);
+            __m256 re_v = _mm256_loadu_ps(dst_re);
+            __m256 im_v = _mm256_loadu_ps(dst_im);
+            re_v = _mm256_fmadd_ps(a_re_v, b_re_v, re_v);
+            re_v = _mm256_fnmadd_ps(a_im_v, b_im_v, re_v);
+            im_v = _mm256_fmadd_ps(a_re_v, b_im_v, im_v);
+            im_v = _mm256_fmadd_ps(a_im_v, b_re_v, im_v);
+            _mm256_storeu_ps(dst_re, re_v);
+            _mm256_storeu_ps(dst_im, im_v);
+            src_a_re += 8;
+            src_a_im += 8;
+            src_b_re += 8;
+            src_b_im += 8;
+            dst_re += 8;
+            dst_im += 8;
+        }
+        SSE::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void cmul(__m256 a_re, __m256 a_im, __m256 b_re, __m256 b_im, __m256 &dst_re, __m256 &dst_im) {
+        dst_re = _mm256_sub_ps(_mm256_mul_ps(a_re, b_re), _mm256_mul_ps(a_im, b_im));
+        dst_im = _mm256_add_ps(_mm256_mul_ps(a_re, b_im), _mm256_mul_ps(a_im, b_re));
+    }
+
+    inline void vradix4(float *re, float *im, const float *twiddles, unsigned stride, unsigned length) {
+        unsigned rem = length % 8;
+        unsigned end = length - rem;
+        for (unsigned j = 0; j < end; j += 8) {
+            __m256 a_re = _mm256_loadu_ps(re + j);
+            __m256 a_im = _mm256_loadu_ps(im + j);
+            __m256 b_re, b_im, c_re, c_im, d_re, d_im;
+            cmul(_mm256_loadu_ps(re + j + stride),
+                 _mm256_loadu_ps(im + j + stride),
+                 _mm256_loadu_ps(twiddles + j),
+                 _mm256_loadu_ps(twiddles + j + stride),
+                 b_re,
+                 b_im);
+            cmul(_mm256_loadu_ps(re + j + 2 * stride),
+                 _mm256_loadu_ps(im + j + 2 * stride),
+                 _mm256_loadu_ps(twiddles + j + 2 * stride),
+                 _mm256_loadu_ps(twiddles + j + 3 * stride),
+                 c_re,
+                 c_im);
+            cmul(_mm256_loadu_ps(re + j + 3 * stride),
+                 _mm256_loadu_ps(im + j + 3 * stride),
+                 _mm256_loadu_ps(twiddles + j + 4 * stride),
+                 _mm256_loadu_ps(twiddles + j + 5 * stride),
+                 d_re,
+                 d_im);
+
+            __m256 t0_re = _mm256_add_ps(a_re, b_re), t0_im = _mm256_add_ps(a_im, b_im);
+            __m256 t1_re = _mm256_sub_ps(a_re, b_re), t1_im = _mm256_sub_ps(a_im, b_im);
+            __m256 t2_re = _mm256_add_ps(c_re, d_re), t2_im = _mm256_add_ps(c_im, d_im);
+            __m256 t3_re = _mm256_sub_ps(c_re, d_re), t3_im = _mm256_sub_ps(c_im, d_im);
+            _mm256_storeu_ps(re + j, _mm256_add_ps(t0_re, t2_re));
+            _mm256_storeu_ps(im + j, _mm256_add_ps(t0_im, t2_im));
+            _mm256_storeu_ps(re + j + stride, _mm256_add_ps(t1_re, t3_im));
+            _mm256_storeu_ps(im + j + stride, _mm256_sub_ps(t1_im, t3_re));
+            _mm256_storeu_ps(re + j + 2 * stride, _mm256_sub_ps(t0_re, t2_re));
+            _mm256_storeu_ps(im + j + 2 * stride, _mm256_sub_ps(t0_im, t2_im));
+            _mm256_storeu_ps(re + j + 3 * stride, _mm256_sub_ps(t1_re, t3_im));
+            _mm256_storeu_ps(im + j + 3 * stride, _mm256_add_ps(t1_im, t3_re));
+        }
+        SSE::vradix4(re + end, im + end, twiddles + end, stride, rem);
+    }
+
+    static constexpr unsigned BIQUAD_LANES = 8;
+
+    template <bool Interpolate>
+    inline void biquad_section(const float *src,
+                               float *dst,
+                               unsigned length,
+                               float *coefficients,
+                               const float *deltas,
+                               float *state) {
+        __m256 b0_v = _mm256_loadu_ps(coefficients);
+        __m256 b1_v = _mm256_loadu_ps(coefficients + BIQUAD_LANES);
+        __m256 b2_v = _mm256_loadu_ps(coefficients + 2 * BIQUAD_LANES);
+        __m256 a1_v = _mm256_loadu_ps(coefficients + 3 * BIQUAD_LANES);
+        __m256 a2_v = _mm256_loadu_ps(coefficients + 4 * BIQUAD_LANES);
+        __m256 db0_v, db1_v, db2_v, da1_v, da2_v;
+        if constexpr (Interpolate) {
+            db0_v = _mm256_loadu_ps(deltas);
+            db1_v = _mm256_loadu_ps(deltas + BIQUAD_LANES);
+            db2_v = _mm256_loadu_ps(deltas + 2 * BIQUAD_LANES);
+            da1_v = _mm256_loadu_ps(deltas + 3 * BIQUAD_LANES);
+            da2_v = _mm256_loadu_ps(deltas + 4 * BIQUAD_LANES);
+        }
+        __m256 z1_v = _mm256_loadu_ps(state);
+        __m256 z2_v = _mm256_loadu_ps(state + BIQUAD_LANES);
+        for (unsigned i = 0; i < length; i++) {
+            __m256 x_v = _mm256_loadu_ps(src + i * BIQUAD_LANES);
+            __m256 y_v = _mm256_fmadd_ps(b0_v, x_v, z1_v);
+            z1_v = _mm256_fnmadd_ps(a1_v, y_v, _mm256_fmadd_ps(b1_v, x_v, z2_v));
+            z2_v = _mm256_fnmadd_ps(a2_v, y_v, _mm256_mul_ps(b2_v, x_v));
+            _mm256_storeu_ps(dst + i * BIQUAD_LANES, y_v);
+            if constexpr (Interpolate) {
+                b0_v = _mm256_add_ps(b0_v, db0_v);
+                b1_v = _mm256_add_ps(b1_v, db1_v);
+                b2_v = _mm256_add_ps(b2_v, db2_v);
+                a1_v = _mm256_add_ps(a1_v, da1_v);
+                a2_v = _mm256_add_ps(a2_v, da2_v);
+            }
+        }
+        if constexpr (Interpolate) {
+            _mm256_storeu_ps(coefficients, b0_v);
+            _mm256_storeu_ps(coefficients + BIQUAD_LANES, b1_v);
+            _mm256_storeu_ps(coefficients + 2 * BIQUAD_LANES, b2_v);
+            _mm256_storeu_ps(coefficients + 3 * BIQUAD_LANES, a1_v);
+            _mm256_storeu_ps(coefficients + 4 * BIQUAD_LANES, a2_v);
+        }
+        _mm256_storeu_ps(state, z1_v);
+        _mm256_storeu_ps(state + BIQUAD_LANES, z2_v);
+    }
+
+    inline void vbiquad(const float *src,
+                        float *dst,
+                        unsigned length,
+                        float *coefficients,
+                        const float *deltas,
+                        float *state,
+                        unsigned sections) {
+        for (unsigned s = 0; s < sections; s++) {
+            const float *section_src = s == 0 ? src : dst;
+            float *section_coefficients = coefficients + s * 5 * BIQUAD_LANES;
+            float *section_state = state + s * 2 * BIQUAD_LANES;
+            if (deltas) {
+                const float *section_deltas = deltas + s * 5 * BIQUAD_LANES;
+                biquad_section<true>(section_src, dst, length, section_coefficients, section_deltas, section_state);
+            } else {
+                biquad_section<false>(section_src, dst, length, section_coefficients, nullptr, section_state);
+            }
+        }
+    }
 } // namespace Dynamo::Vectorize::AVX
\ No newline at end of file
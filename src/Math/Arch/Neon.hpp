@@ -178,4 +178,374 @@ namespace Dynamo::Vectorize::Neon {
 
         Scalar::vclamp(src, lo, hi, dst, rem_1);
     }
+
+    inline void vconvert_s16(const int16_t *src, const float scalar, float *dst, unsigned length) {
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            int16x8_t src_v = vld1q_s16(src);
+            float32x4_t lo_v = vcvtq_f32_s32(vmovl_s16(vget_low_s16(src_v)));
+            float32x4_t hi_v = vcvtq_f32_s32(vmovl_s16(vget_high_s16(src_v)));
+            vst1q_f32(dst, vmulq_n_f32(lo_v, scalar));
+            vst1q_f32(dst + 4, vmulq_n_f32(hi_v, scalar));
+            src += 8;
+            dst += 8;
+        }
+        Scalar::vconvert_s16(src, scalar, dst, rem);
+    }
+
+    inline void vconvert_s24(const uint8_t *src, const float scalar, float *dst, unsigned length) {
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // Load the 3 bytes of 8 samples into separate vectors, then sign extend the top byte
+            uint8x8x3_t src_v = vld3_u8(src);
+            uint16x8_t low_v = vorrq_u16(vmovl_u8(src_v.val[0]), vshlq_n_u16(vmovl_u8(src_v.val[1]), 8));
+            int16x8_t high_v = vmovl_s8(vreinterpret_s8_u8(src_v.val[2]));
+            int32x4_t lo_v = vorrq_s32(vshlq_n_s32(vmovl_s16(vget_low_s16(high_v)), 16),
+                                       vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(low_v))));
+            int32x4_t hi_v = vorrq_s32(vshlq_n_s32(vmovl_s16(vget_high_s16(high_v)), 16),
+                                       vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(low_v))));
+            vst1q_f32(dst, vmulq_n_f32(vcvtq_f32_s32(lo_v), scalar));
+            vst1q_f32(dst + 4, vmulq_n_f32(vcvtq_f32_s32(hi_v), scalar));
+            src += 24;
+            dst += 8;
+        }
+        Scalar::vconvert_s24(src, scalar, dst, rem);
+    }
+
+    inline void vconvert_s32(const int32_t *src, const float scalar, float *dst, unsigned length) {
+        unsigned rem = length % 4;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            vst1q_f32(dst, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(src)), scalar));
+            src += 4;
+            dst += 4;
+        }
+        Scalar::vconvert_s32(src, scalar, dst, rem);
+    }
+
+    inline int32x4_t quantize(const float *src, float scalar, const float *dither, float32x4_t lo_v, float32x4_t hi_v) {
+        float32x4_t sample_v = vmulq_n_f32(vld1q_f32(src), scalar);
+        if (dither) {
+            sample_v = vaddq_f32(sample_v, vld1q_f32(dither));
+        }
+        sample_v = vmaxq_f32(lo_v, vminq_f32(hi_v, sample_v));
+#if defined(__aarch64__)
+        return vcvtnq_s32_f32(sample_v);
+#else
+        // ARMv7 only converts toward zero, so round to nearest by biasing half a step away from zero
+        uint32x4_t negative_v = vcltq_f32(sample_v, vdupq_n_f32(0));
+        float32x4_t bias_v = vbslq_f32(negative_v, vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+        return vcvtq_s32_f32(vaddq_f32(sample_v, bias_v));
+#endif
+    }
+
+    inline void vquantize_s16(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int16_t *dst,
+                              unsigned length) {
+        float32x4_t lo_v = vdupq_n_f32(-32768.0f);
+        float32x4_t hi_v = vdupq_n_f32(32767.0f);
+        unsigned rem = length % 8;
+        int16_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            int32x4_t lo_i = quantize(src, scalar, dither, lo_v, hi_v);
+            int32x4_t hi_i = quantize(src + 4, scalar, dither ? dither + 4 : nullptr, lo_v, hi_v);
+            vst1q_s16(dst, vcombine_s16(vqmovn_s32(lo_i), vqmovn_s32(hi_i)));
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 8;
+        }
+        Scalar::vquantize_s16(src, scalar, dither, dst, rem);
+    }
+
+    inline void vquantize_s24(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              uint8_t *dst,
+                              unsigned length) {
+        float32x4_t lo_v = vdupq_n_f32(-8388608.0f);
+        float32x4_t hi_v = vdupq_n_f32(8388607.0f);
+        unsigned rem = length % 8;
+        const float *src_end = src + length - rem;
+        while (src < src_end) {
+            // Split the low 3 bytes of 8 samples into separate vectors and store them interleaved
+            const float *hi_dither = dither ? dither + 4 : nullptr;
+            uint32x4_t lo_i = vreinterpretq_u32_s32(quantize(src, scalar, dither, lo_v, hi_v));
+            uint32x4_t hi_i = vreinterpretq_u32_s32(quantize(src + 4, scalar, hi_dither, lo_v, hi_v));
+            uint8x8x3_t dst_v;
+            dst_v.val[0] = vmovn_u16(vcombine_u16(vmovn_u32(lo_i), vmovn_u32(hi_i)));
+            dst_v.val[1] = vmovn_u16(vcombine_u16(vshrn_n_u32(lo_i, 8), vshrn_n_u32(hi_i, 8)));
+            dst_v.val[2] = vmovn_u16(vcombine_u16(vshrn_n_u32(lo_i, 16), vshrn_n_u32(hi_i, 16)));
+            vst3_u8(dst, dst_v);
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 24;
+        }
+        Scalar::vquantize_s24(src, scalar, dither, dst, rem);
+    }
+
+    inline void vquantize_s32(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int32_t *dst,
+                              unsigned length) {
+        float32x4_t lo_v = vdupq_n_f32(-2147483648.0f);
+        float32x4_t hi_v = vdupq_n_f32(2147483520.0f);
+        unsigned rem = length % 4;
+        int32_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            vst1q_s32(dst, quantize(src, scalar, dither, lo_v, hi_v));
+            src += 4;
+            dither = dither ? dither + 4 : nullptr;
+            dst += 4;
+        }
+        Scalar::vquantize_s32(src, scalar, dither, dst, rem);
+    }
+
+    inline void vinterleave(const float *src, unsigned stride, unsigned channels, float *dst, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 1:
+            std::copy(src, src + length, dst);
+            return;
+        case 2:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x2_t dst_v = {vld1q_f32(src + f), vld1q_f32(src + stride + f)};
+                vst2q_f32(dst + 2 * f, dst_v);
+            }
+            break;
+        case 3:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x3_t dst_v = {vld1q_f32(src + f),
+                                       vld1q_f32(src + stride + f),
+                                       vld1q_f32(src + 2 * stride + f)};
+                vst3q_f32(dst + 3 * f, dst_v);
+            }
+            break;
+        case 4:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x4_t dst_v = {vld1q_f32(src + f),
+                                       vld1q_f32(src + stride + f),
+                                       vld1q_f32(src + 2 * stride + f),
+                                       vld1q_f32(src + 3 * stride + f)};
+                vst4q_f32(dst + 4 * f, dst_v);
+            }
+            break;
+        default:
+            Scalar::vinterleave(src, stride, channels, dst, length);
+            return;
+        }
+        Scalar::vinterleave(src + end, stride, channels, dst + end * channels, rem);
+    }
+
+    inline void vdeinterleave(const float *src, unsigned channels, float *dst, unsigned stride, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 1:
+            std::copy(src, src + length, dst);
+            return;
+        case 2:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x2_t src_v = vld2q_f32(src + 2 * f);
+                vst1q_f32(dst + f, src_v.val[0]);
+                vst1q_f32(dst + stride + f, src_v.val[1]);
+            }
+            break;
+        case 3:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x3_t src_v = vld3q_f32(src + 3 * f);
+                vst1q_f32(dst + f, src_v.val[0]);
+                vst1q_f32(dst + stride + f, src_v.val[1]);
+                vst1q_f32(dst + 2 * stride + f, src_v.val[2]);
+            }
+            break;
+        case 4:
+            for (unsigned f = 0; f < end; f += 4) {
+                float32x4x4_t src_v = vld4q_f32(src + 4 * f);
+                vst1q_f32(dst + f, src_v.val[0]);
+                vst1q_f32(dst + stride + f, src_v.val[1]);
+                vst1q_f32(dst + 2 * stride + f, src_v.val[2]);
+                vst1q_f32(dst + 3 * stride + f, src_v.val[3]);
+            }
+            break;
+        default:
+            Scalar::vdeinterleave(src, channels, dst, stride, length);
+            return;
+        }
+        Scalar::vdeinterleave(src + end * channels, channels, dst + end, stride, rem);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        float32x4_t sum_v = vdupq_n_f32(0);
+        unsigned rem = length % 4;
+        const float *src_a_end = src_a + length - rem;
+        while (src_a < src_a_end) {
+            float32x4_t src_a_v = vld1q_f32(src_a);
+            float32x4_t src_b_v = vld1q_f32(src_b);
+            sum_v = vmlaq_f32(sum_v, src_a_v, src_b_v);
+            src_a += 4;
+            src_b += 4;
+        }
+        // Pairwise adds, since the horizontal add across a vector is only available on AArch64
+        float32x2_t sum_v2 = vadd_f32(vget_low_f32(sum_v), vget_high_f32(sum_v));
+        return vget_lane_f32(vpadd_f32(sum_v2, sum_v2), 0) + Scalar::vdot(src_a, src_b, rem);
+    }
+
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 4;
+        float *dst_re_end = dst_re + length - rem;
+        while (dst_re < dst_re_end) {
+            float32x4_t a_re_v = vld1q_f32(src_a_re);
+            float32x4_t a_im_v = vld1q_f32(src_a_im);
+            float32x4_t b_re_v = vld1q_f32(src_b_re);
+            float32x4_t b_im_v = vld1q_f32(src_b_im);
+            float32x4_t re_v = vld1q_f32(dst_re);
+            float32x4_t im_v = vld1q_f32(dst_im);
+            re_v = vmlaq_f32(re_v, a_re_v, b_re_v);
+            re_v = vmlsq_f32(re_v, a_im_v, b_im_v);
+            im_v = vmlaq_f32(im_v, a_re_v, b_im_v);
+            im_v = vmlaq_f32(im_v, a_im_v, b_re_v);
+            vst1q_f32(dst_re, re_v);
+            vst1q_f32(dst_im, im_v);
+            src_a_re += 4;
+            src_a_im += 4;
+            src_b_re += 4;
+            src_b_im += 4;
+            dst_re += 4;
+            dst_im += 4;
+        }
+        Scalar::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void cmul(float32x4_t a_re,
+                     float32x4_t a_im,
+                     float32x4_t b_re,
+                     float32x4_t b_im,
+                     float32x4_t &dst_re,
+                     float32x4_t &dst_im) {
+        dst_re = vmlsq_f32(vmulq_f32(a_re, b_re), a_im, b_im);
+        dst_im = vmlaq_f32(vmulq_f32(a_re, b_im), a_im, b_re);
+    }
+
+    inline void vradix4(float *re, float *im, const float *twiddles, unsigned stride, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        for (unsigned j = 0; j < end; j += 4) {
+            float32x4_t a_re = vld1q_f32(re + j);
+            float32x4_t a_im = vld1q_f32(im + j);
+            float32x4_t b_re, b_im, c_re, c_im, d_re, d_im;
+            cmul(vld1q_f32(re + j + stride),
+                 vld1q_f32(im + j + stride),
+                 vld1q_f32(twiddles + j),
+                 vld1q_f32(twiddles + j + stride),
+                 b_re,
+                 b_im);
+            cmul(vld1q_f32(re + j + 2 * stride),
+                 vld1q_f32(im + j + 2 * stride),
+                 vld1q_f32(twiddles + j + 2 * stride),
+                 vld1q_f32(twiddles + j + 3 * stride),
+                 c_re,
+                 c_im);
+            cmul(vld1q_f32(re + j + 3 * stride),
+                 vld1q_f32(im + j + 3 * stride),
+                 vld1q_f32(twiddles + j + 4 * stride),
+                 vld1q_f32(twiddles + j + 5 * stride),
+                 d_re,
+                 d_im);
+
+            float32x4_t t0_re = vaddq_f32(a_re, b_re), t0_im = vaddq_f32(a_im, b_im);
+            float32x4_t t1_re = vsubq_f32(a_re, b_re), t1_im = vsubq_f32(a_im, b_im);
+            float32x4_t t2_re = vaddq_f32(c_re, d_re), t2_im = vaddq_f32(c_im, d_im);
+            float32x4_t t3_re = vsubq_f32(c_re, d_re), t3_im = vsubq_f32(c_im, d_im);
+            vst1q_f32(re + j, vaddq_f32(t0_re, t2_re));
+            vst1q_f32(im + j, vaddq_f32(t0_im, t2_im));
+            vst1q_f32(re + j + stride, vaddq_f32(t1_re, t3_im));
+            vst1q_f32(im + j + stride, vsubq_f32(t1_im, t3_re));
+            vst1q_f32(re + j + 2 * stride, vsubq_f32(t0_re, t2_re));
+            vst1q_f32(im + j + 2 * stride, vsubq_f32(t0_im, t2_im));
+            vst1q_f32(re + j + 3 * stride, vsubq_f32(t1_re, t3_im));
+            vst1q_f32(im + j + 3 * stride, vaddq_f32(t1_im, t3_re));
+        }
+        Scalar::vradix4(re + end, im + end, twiddles + end, stride, rem);
+    }
+
+    static constexpr unsigned BIQUAD_LANES = 4;
+
+    template <bool Interpolate>
+    inline void biquad_section(const float *src,
+                               float *dst,
+                               unsigned length,
+                               float *coefficients,
+                               const float *deltas,
+                               float *state) {
+        float32x4_t b0_v = vld1q_f32(coefficients);
+        float32x4_t b1_v = vld1q_f32(coefficients + BIQUAD_LANES);
+        float32x4_t b2_v = vld1q_f32(coefficients + 2 * BIQUAD_LANES);
+        float32x4_t a1_v = vld1q_f32(coefficients + 3 * BIQUAD_LANES);
+        float32x4_t a2_v = vld1q_f32(coefficients + 4 * BIQUAD_LANES);
+        float32x4_t db0_v, db1_v, db2_v, da1_v, da2_v;
+        if constexpr (Interpolate) {
+            db0_v = vld1q_f32(deltas);
+            db1_v = vld1q_f32(deltas + BIQUAD_LANES);
+            db2_v = vld1q_f32(deltas + 2 * BIQUAD_LANES);
+            da1_v = vld1q_f32(deltas + 3 * BIQUAD_LANES);
+            da2_v = vld1q_f32(deltas + 4 * BIQUAD_LANES);
+        }
+        float32x4_t z1_v = vld1q_f32(state);
+        float32x4_t z2_v = vld1q_f32(state + BIQUAD_LANES);
+        for (unsigned i = 0; i < length; i++) {
+            float32x4_t x_v = vld1q_f32(src + i * BIQUAD_LANES);
+            float32x4_t y_v = vmlaq_f32(z1_v, b0_v, x_v);
+            z1_v = vmlsq_f32(vmlaq_f32(z2_v, b1_v, x_v), a1_v, y_v);
+            z2_v = vmlsq_f32(vmulq_f32(b2_v, x_v), a2_v, y_v);
+            vst1q_f32(dst + i * BIQUAD_LANES, y_v);
+            if constexpr (Interpolate) {
+                b0_v = vaddq_f32(b0_v, db0_v);
+                b1_v = vaddq_f32(b1_v, db1_v);
+                b2_v = vaddq_f32(b2_v, db2_v);
+                a1_v = vaddq_f32(a1_v, da1_v);
+                a2_v = vaddq_f32(a2_v, da2_v);
+            }
+        }
+        if constexpr (Interpolate) {
+            vst1q_f32(coefficients, b0_v);
+            vst1q_f32(coefficients + BIQUAD_LANES, b1_v);
+            vst1q_f32(coefficients + 2 * BIQUAD_LANES, b2_v);
+            vst1q_f32(coefficients + 3 * BIQUAD_LANES, a1_v);
+            vst1q_f32(coefficients + 4 * BIQUAD_LANES, a2_v);
+        }
+        vst1q_f32(state, z1_v);
+        vst1q_f32(state + BIQUAD_LANES, z2_v);
+    }
+
+    inline void vbiquad(const float *src,
+                        float *dst,
+                        unsigned length,
+                        float *coefficients,
+                        const float *deltas,
+                        float *state,
+                        unsigned sections) {
+        for (unsigned s = 0; s < sections; s++) {
+            const float *section_src = s == 0 ? src : dst;
+            float *section_coefficients = coefficients + s * 5 * BIQUAD_LANES;
+            float *section_state = state + s * 2 * BIQUAD_LANES;
+            if (deltas) {
+                const float *section_deltas = deltas + s * 5 * BIQUAD_LANES;
+                biquad_section<true>(section_src, dst, length, section_coefficients, section_deltas, section_state);
+            } else {
+                biquad_section<false>(section_src, dst, length, section_coefficients, nullptr, section_state);
+            }
+        }
+    }
 } // namespace Dynamo::Vectorize::Neon
\ No newline at end of file
@@ -78,4 +78,332 @@ namespace Dynamo::Vectorize::SSE {
         }
         Scalar::vclamp(src, lo, hi, dst, rem);
     }
+
+    inline void vconvert_s16(const int16_t *src, const float scalar, float *dst, unsigned length) {
+        __m128 scalar_v = _mm_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // Sign extend by unpacking each sample into the high half of a 32-bit lane
+            __m128i src_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i lo_v = _mm_srai_epi32(_mm_unpacklo_epi16(src_v, src_v), 16);
+            __m128i hi_v = _mm_srai_epi32(_mm_unpackhi_epi16(src_v, src_v), 16);
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(lo_v), scalar_v));
+            _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi_v), scalar_v));
+            src += 8;
+            dst += 8;
+        }
+        Scalar::vconvert_s16(src, scalar, dst, rem);
+    }
+
+    inline void vconvert_s24(const uint8_t *src, const float scalar, float *dst, unsigned length) {
+        // Unpacking 3 byte samples needs a byte shuffle, which SSE does not have
+        Scalar::vconvert_s24(src, scalar, dst, length);
+    }
+
+    inline void vconvert_s32(const int32_t *src, const float scalar, float *dst, unsigned length) {
+        __m128 scalar_v = _mm_set1_ps(scalar);
+        unsigned rem = length % 4;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            __m128i src_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(src_v), scalar_v));
+            src += 4;
+            dst += 4;
+        }
+        Scalar::vconvert_s32(src, scalar, dst, rem);
+    }
+
+    inline __m128i quantize(const float *src, __m128 scalar_v, const float *dither, __m128 lo_v, __m128 hi_v) {
+        __m128 sample_v = _mm_mul_ps(_mm_loadu_ps(src), scalar_v);
+        if (dither) {
+            sample_v = _mm_add_ps(sample_v, _mm_loadu_ps(dither));
+        }
+        return _mm_cvtps_epi32(_mm_max_ps(lo_v, _mm_min_ps(hi_v, sample_v)));
+    }
+
+    inline void vquantize_s16(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int16_t *dst,
+                              unsigned length) {
+        __m128 scalar_v = _mm_set1_ps(scalar);
+        __m128 lo_v = _mm_set1_ps(-32768.0f);
+        __m128 hi_v = _mm_set1_ps(32767.0f);
+        unsigned rem = length % 8;
+        int16_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            __m128i lo_i = quantize(src, scalar_v, dither, lo_v, hi_v);
+            __m128i hi_i = quantize(src + 4, scalar_v, dither ? dither + 4 : nullptr, lo_v, hi_v);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packs_epi32(lo_i, hi_i));
+            src += 8;
+            dither = dither ? dither + 8 : nullptr;
+            dst += 8;
+        }
+        Scalar::vquantize_s16(src, scalar, dither, dst, rem);
+    }
+
+    inline void vquantize_s24(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              uint8_t *dst,
+                              unsigned length) {
+        // Packing 3 byte samples needs a byte shuffle, which SSE does not have
+        Scalar::vquantize_s24(src, scalar, dither, dst, length);
+    }
+
+    inline void vquantize_s32(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int32_t *dst,
+                              unsigned length) {
+        __m128 scalar_v = _mm_set1_ps(scalar);
+        __m128 lo_v = _mm_set1_ps(-2147483648.0f);
+        __m128 hi_v = _mm_set1_ps(2147483520.0f);
+        unsigned rem = length % 4;
+        int32_t *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), quantize(src, scalar_v, dither, lo_v, hi_v));
+            src += 4;
+            dither = dither ? dither + 4 : nullptr;
+            dst += 4;
+        }
+        Scalar::vquantize_s32(src, scalar, dither, dst, rem);
+    }
+
+    inline void vinterleave(const float *src, unsigned stride, unsigned channels, float *dst, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 1:
+            std::copy(src, src + length, dst);
+            return;
+        case 2:
+            for (unsigned f = 0; f < end; f += 4) {
+                __m128 l_v = _mm_loadu_ps(src + f);
+                __m128 r_v = _mm_loadu_ps(src + stride + f);
+                _mm_storeu_ps(dst + 2 * f, _mm_unpacklo_ps(l_v, r_v));
+                _mm_storeu_ps(dst + 2 * f + 4, _mm_unpackhi_ps(l_v, r_v));
+            }
+            break;
+        case 4:
+            for (unsigned f = 0; f < end; f += 4) {
+                __m128 a_v = _mm_loadu_ps(src + f);
+                __m128 b_v = _mm_loadu_ps(src + stride + f);
+                __m128 c_v = _mm_loadu_ps(src + 2 * stride + f);
+                __m128 d_v = _mm_loadu_ps(src + 3 * stride + f);
+                _MM_TRANSPOSE4_PS(a_v, b_v, c_v, d_v);
+                _mm_storeu_ps(dst + 4 * f, a_v);
+                _mm_storeu_ps(dst + 4 * f + 4, b_v);
+                _mm_storeu_ps(dst + 4 * f + 8, c_v);
+                _mm_storeu_ps(dst + 4 * f + 12, d_v);
+            }
+            break;
+        default:
+            Scalar::vinterleave(src, stride, channels, dst, length);
+            return;
+        }
+        Scalar::vinterleave(src + end, stride, channels, dst + end * channels, rem);
+    }
+
+    inline void vdeinterleave(const float *src, unsigned channels, float *dst, unsigned stride, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 1:
+            std::copy(src, src + length, dst);
+            return;
+        case 2:
+            for (unsigned f = 0; f < end; f += 4) {
+                __m128 a_v = _mm_loadu_ps(src + 2 * f);
+                __m128 b_v = _mm_loadu_ps(src + 2 * f + 4);
+                _mm_storeu_ps(dst + f, _mm_shuffle_ps(a_v, b_v, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(dst + stride + f, _mm_shuffle_ps(a_v, b_v, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            break;
+        case 4:
+            for (unsigned f = 0; f < end; f += 4) {
+                __m128 a_v = _mm_loadu_ps(src + 4 * f);
+                __m128 b_v = _mm_loadu_ps(src + 4 * f + 4);
+                __m128 c_v = _mm_loadu_ps(src + 4 * f + 8);
+                __m128 d_v = _mm_loadu_ps(src + 4 * f + 12);
+                _MM_TRANSPOSE4_PS(a_v, b_v, c_v, d_v);
+                _mm_storeu_ps(dst + f, a_v);
+                _mm_storeu_ps(dst + stride + f, b_v);
+                _mm_storeu_ps(dst + 2 * stride + f, c_v);
+                _mm_storeu_ps(dst + 3 * stride + f, d_v);
+            }
+            break;
+        default:
+            Scalar::vdeinterleave(src, channels, dst, stride, length);
+            return;
+        }
+        Scalar::vdeinterleave(src + end * channels, channels, dst + end, stride, rem);
+    }
+
+    inline float hsum(__m128 src_v) {
+        __m128 shuf_v = _mm_movehl_ps(src_v, src_v);
+        __m128 sum_v = _mm_add_ps(src_v, shuf_v);
+        shuf_v = _mm_shuffle_ps(sum_v, sum_v, 1);
+        sum_v = _mm_add_ss(sum_v, shuf_v);
+        return _mm_cvtss_f32(sum_v);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        __m128 sum_v = _mm_setzero_ps();
+        unsigned rem = length % 4;
+        const float *src_a_end = src_a + length - rem;
+        while (src_a < src_a_end) {
+            __m128 src_a_v = _mm_loadu_ps(src_a);
+            __m128 src_b_v = _mm_loadu_ps(src_b);
+            sum_v = _mm_add_ps(_mm_mul_ps(src_a_v, src_b_v), sum_v);
+            src_a += 4;
+            src_b += 4;
+        }
+        return hsum(sum_v) + Scalar::vdot(src_a, src_b, rem);
+    }
+
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 4;
+        float *dst_re_end = dst_re + length - rem;
+        while (dst_re < dst_re_end) {
+            __m128 a_re_v = _mm_loadu_ps(src_a_re);
+            __m128 a_im_v = _mm_loadu_ps(src_a_im);
+            __m128 b_re_v = _mm_loadu_ps(src_b_re);
+            __m128 b_im_v = _mm_loadu_ps(src_b_im);
+            __m128 re_v = _mm_sub_ps(_mm_mul_ps(a_re_v, b_re_v), _mm_mul_ps(a_im_v, b_im_v));
+            __m128 im_v = _mm_add_ps(_mm_mul_ps(a_re_v, b_im_v), _mm_mul_ps(a_im_v, b_re_v));
+            _mm_storeu_ps(dst_re, _mm_add_ps(_mm_loadu_ps(dst_re), re_v));
+            _mm_storeu_ps(dst_im, _mm_add_ps(_mm_loadu_ps(dst_im), im_v));
+            src_a_re += 4;
+            src_a_im += 4;
+            src_b_re += 4;
+            src_b_im += 4;
+            dst_re += 4;
+            dst_im += 4;
+        }
+        Scalar::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void cmul(__m128 a_re, __m128 a_im, __m128 b_re, __m128 b_im, __m128 &dst_re, __m128 &dst_im) {
+        dst_re = _mm_sub_ps(_mm_mul_ps(a_re, b_re), _mm_mul_ps(a_im, b_im));
+        dst_im = _mm_add_ps(_mm_mul_ps(a_re, b_im), _mm_mul_ps(a_im, b_re));
+    }
+
+    inline void vradix4(float *re, float *im, const float *twiddles, unsigned stride, unsigned length) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        for (unsigned j = 0; j < end; j += 4) {
+            __m128 a_re = _mm_loadu_ps(re + j);
+            __m128 a_im = _mm_loadu_ps(im + j);
+            __m128 b_re, b_im, c_re, c_im, d_re, d_im;
+            cmul(_mm_loadu_ps(re + j + stride),
+                 _mm_loadu_ps(im + j + stride),
+                 _mm_loadu_ps(twiddles + j),
+                 _mm_loadu_ps(twiddles + j + stride),
+                 b_re,
+                 b_im);
+            cmul(_mm_loadu_ps(re + j + 2 * stride),
+                 _mm_loadu_ps(im + j + 2 * stride),
+                 _mm_loadu_ps(twiddles + j + 2 * stride),
+                 _mm_loadu_ps(twiddles + j + 3 * stride),
+                 c_re,
+                 c_im);
+            cmul(_mm_loadu_ps(re + j + 3 * stride),
+                 _mm_loadu_ps(im + j + 3 * stride),
+                 _mm_loadu_ps(twiddles + j + 4 * stride),
+                 _mm_loadu_ps(twiddles + j + 5 * stride),
+                 d_re,
+                 d_im);
+
+            __m128 t0_re = _mm_add_ps(a_re, b_re), t0_im = _mm_add_ps(a_im, b_im);
+            __m128 t1_re = _mm_sub_ps(a_re, b_re), t1_im = _mm_sub_ps(a_im, b_im);
+            __m128 t2_re = _mm_add_ps(c_re, d_re), t2_im = _mm_add_ps(c_im, d_im);
+            __m128 t3_re = _mm_sub_ps(c_re, d_re), t3_im = _mm_sub_ps(c_im, d_im);
+            _mm_storeu_ps(re + j, _mm_add_ps(t0_re, t2_re));
+            _mm_storeu_ps(im + j, _mm_add_ps(t0_im, t2_im));
+            _mm_storeu_ps(re + j + stride, _mm_add_ps(t1_re, t3_im));
+            _mm_storeu_ps(im + j + stride, _mm_sub_ps(t1_im, t3_re));
+            _mm_storeu_ps(re + j + 2 * stride, _mm_sub_ps(t0_re, t2_re));
+            _mm_storeu_ps(im + j + 2 * stride, _mm_sub_ps(t0_im, t2_im));
+            _mm_storeu_ps(re + j + 3 * stride, _mm_sub_ps(t1_re, t3_im));
+            _mm_storeu_ps(im + j + 3 * stride, _mm_add_ps(t1_im, t3_re));
+        }
+        Scalar::vradix4(re + end, im + end, twiddles + end, stride, rem);
+    }
+
+    static constexpr unsigned BIQUAD_LANES = 4;
+
+    template <bool Interpolate>
+    inline void biquad_section(const float *src,
+                               float *dst,
+                               unsigned length,
+                               float *coefficients,
+                               const float *deltas,
+                               float *state) {
+        __m128 b0_v = _mm_loadu_ps(coefficients);
+        __m128 b1_v = _mm_loadu_ps(coefficients + BIQUAD_LANES);
+        __m128 b2_v = _mm_loadu_ps(coefficients + 2 * BIQUAD_LANES);
+        __m128 a1_v = _mm_loadu_ps(coefficients + 3 * BIQUAD_LANES);
+        __m128 a2_v = _mm_loadu_ps(coefficients + 4 * BIQUAD_LANES);
+        __m128 db0_v, db1_v, db2_v, da1_v, da2_v;
+        if constexpr (Interpolate) {
+            db0_v = _mm_loadu_ps(deltas);
+            db1_v = _mm_loadu_ps(deltas + BIQUAD_LANES);
+            db2_v = _mm_loadu_ps(deltas + 2 * BIQUAD_LANES);
+            da1_v = _mm_loadu_ps(deltas + 3 * BIQUAD_LANES);
+            da2_v = _mm_loadu_ps(deltas + 4 * BIQUAD_LANES);
+        }
+        __m128 z1_v = _mm_loadu_ps(state);
+        __m128 z2_v = _mm_loadu_ps(state + BIQUAD_LANES);
+        for (unsigned i = 0; i < length; i++) {
+            __m128 x_v = _mm_loadu_ps(src + i * BIQUAD_LANES);
+            __m128 y_v = _mm_add_ps(_mm_mul_ps(b0_v, x_v), z1_v);
+            z1_v = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1_v, x_v), _mm_mul_ps(a1_v, y_v)), z2_v);
+            z2_v = _mm_sub_ps(_mm_mul_ps(b2_v, x_v), _mm_mul_ps(a2_v, y_v));
+            _mm_storeu_ps(dst + i * BIQUAD_LANES, y_v);
+            if constexpr (Interpolate) {
+                b0_v = _mm_add_ps(b0_v, db0_v);
+                b1_v = _mm_add_ps(b1_v, db1_v);
+                b2_v = _mm_add_ps(b2_v, db2_v);
+                a1_v = _mm_add_ps(a1_v, da1_v);
+                a2_v = _mm_add_ps(a2_v, da2_v);
+            }
+        }
+        if constexpr (Interpolate) {
+            _mm_storeu_ps(coefficients, b0_v);
+            _mm_storeu_ps(coefficients + BIQUAD_LANES, b1_v);
+            _mm_storeu_ps(coefficients + 2 * BIQUAD_LANES, b2_v);
+            _mm_storeu_ps(coefficients + 3 * BIQUAD_LANES, a1_v);
+            _mm_storeu_ps(coefficients + 4 * BIQUAD_LANES, a2_v);
+        }
+        _mm_storeu_ps(state, z1_v);
+        _mm_storeu_ps(state + BIQUAD_LANES, z2_v);
+    }
+
+    inline void vbiquad(const float *src,
+                        float *dst,
+                        unsigned length,
+                        float *coefficients,
+                        const float *deltas,
+                        float *state,
+                        unsigned sections) {
+        for (unsigned s = 0; s < sections; s++) {
+            const float *section_src = s == 0 ? src : dst;
+            float *section_coefficients = coefficients + s * 5 * BIQUAD_LANES;
+            float *section_state = state + s * 2 * BIQUAD_LANES;
+            if (deltas) {
+                const float *section_deltas = deltas + s * 5 * BIQUAD_LANES;
+                biquad_section<true>(section_src, dst, length, section_coefficients, section_deltas, section_state);
+            } else {
+                biquad_section<false>(section_src, dst, length, section_coefficients, nullptr, section_state);
+            }
+        }
+    }
 } // namespace Dynamo::Vectorize::SSE
\ No newline at end of file
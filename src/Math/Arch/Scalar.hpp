@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 
 namespace Dynamo::Vectorize::Scalar {
     inline void smul(const float *src_a, const float scalar, float *dst, unsigned length) {
@@ -32,4 +34,186 @@ namespace Dynamo::Vectorize::Scalar {
             dst[i] = std::clamp(src[i], lo, hi);
         }
     }
+
+    inline void vconvert_s16(const int16_t *src, const float scalar, float *dst, unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            dst[i] = src[i] * scalar;
+        }
+    }
+
+    inline void vconvert_s24(const uint8_t *src, const float scalar, float *dst, unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            uint32_t bits = src[3 * i] | (src[3 * i + 1] << 8) | (src[3 * i + 2] << 16);
+            dst[i] = (static_cast<int32_t>(bits << 8) >> 8) * scalar;
+        }
+    }
+
+    inline void vconvert_s32(const int32_t *src, const float scalar, float *dst, unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            dst[i] = src[i] * scalar;
+        }
+    }
+
+    inline void vquantize_s16(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int16_t *dst,
+                              unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            float sample = src[i] * scalar + (dither ? dither[i] : 0);
+            dst[i] = std::lrint(std::clamp(sample, -32768.0f, 32767.0f));
+        }
+    }
+
+    inline void vquantize_s24(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              uint8_t *dst,
+                              unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            float sample = src[i] * scalar + (dither ? dither[i] : 0);
+            int32_t value = std::lrint(std::clamp(sample, -8388608.0f, 8388607.0f));
+            dst[3 * i] = value & 0xff;
+            dst[3 * i + 1] = (value >> 8) & 0xff;
+            dst[3 * i + 2] = (value >> 16) & 0xff;
+        }
+    }
+
+    inline void vquantize_s32(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int32_t *dst,
+                              unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            // 2147483520 is the largest float below 2^31
+            float sample = src[i] * scalar + (dither ? dither[i] : 0);
+            dst[i] = std::lrint(std::clamp(sample, -2147483648.0f, 2147483520.0f));
+        }
+    }
+
+    inline void vinterleave(const float *src, unsigned stride, unsigned channels, float *dst, unsigned length) {
+        for (unsigned f = 0; f < length; f++) {
+            for (unsigned c = 0; c < channels; c++) {
+                dst[f * channels + c] = src[c * stride + f];
+            }
+        }
+    }
+
+    inline void vdeinterleave(const float *src, unsigned channels, float *dst, unsigned stride, unsigned length) {
+        for (unsigned c = 0; c < channels; c++) {
+            for (unsigned f = 0; f < length; f++) {
+                dst[c * stride + f] = src[f * channels + c];
+            }
+        }
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        float sum = 0;
+        for (unsigned i = 0; i < length; i++) {
+            sum += src_a[i] * src_b[i];
+        }
+        return sum;
+    }
+
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            dst_re[i] += src_a_re[i] * src_b_re[i] - src_a_im[i] * src_b_im[i];
+            dst_im[i] += src_a_re[i] * src_b_im[i] + src_a_im[i] * src_b_re[i];
+        }
+    }
+
+    inline void vradix4(float *re, float *im, const float *twiddles, unsigned stride, unsigned length) {
+        for (unsigned j = 0; j < length; j++) {
+            float a_re = re[j];
+            float a_im = im[j];
+            float b_re = re[j + stride] * twiddles[j] - im[j + stride] * twiddles[j + stride];
+            float b_im = re[j + stride] * twiddles[j + stride] + im[j + stride] * twiddles[j];
+            float c_re = re[j + 2 * stride] * twiddles[j + 2 * stride] - im[j + 2 * stride] * twiddles[j + 3 * stride];
+            float c_im = re[j + 2 * stride] * twiddles[j + 3 * stride] + im[j + 2 * stride] * twiddles[j + 2 * stride];
+            float d_re = re[j + 3 * stride] * twiddles[j + 4 * stride] - im[j + 3 * stride] * twiddles[j + 5 * stride];
+            float d_im = re[j + 3 * stride] * twiddles[j + 5 * stride] + im[j + 3 * stride] * twiddles[j + 4 * stride];
+
+            float t0_re = a_re + b_re, t0_im = a_im + b_im;
+            float t1_re = a_re - b_re, t1_im = a_im - b_im;
+            float t2_re = c_re + d_re, t2_im = c_im + d_im;
+            float t3_re = c_re - d_re, t3_im = c_im - d_im;
+            re[j] = t0_re + t2_re;
+            im[j] = t0_im + t2_im;
+            re[j + stride] = t1_re + t3_im;
+            im[j + stride] = t1_im - t3_re;
+            re[j + 2 * stride] = t0_re - t2_re;
+            im[j + 2 * stride] = t0_im - t2_im;
+            re[j + 3 * stride] = t1_re - t3_im;
+            im[j + 3 * stride] = t1_im + t3_re;
+        }
+    }
+
+    static constexpr unsigned BIQUAD_LANES = 4;
+
+    template <bool Interpolate>
+    inline void biquad_section(const float *src,
+                               float *dst,
+                               unsigned length,
+                               float *coefficients,
+                               const float *deltas,
+                               float *state) {
+        for (unsigned l = 0; l < BIQUAD_LANES; l++) {
+            float b0 = coefficients[l];
+            float b1 = coefficients[BIQUAD_LANES + l];
+            float b2 = coefficients[2 * BIQUAD_LANES + l];
+            float a1 = coefficients[3 * BIQUAD_LANES + l];
+            float a2 = coefficients[4 * BIQUAD_LANES + l];
+            float z1 = state[l];
+            float z2 = state[BIQUAD_LANES + l];
+            for (unsigned i = 0; i < length; i++) {
+                float x = src[i * BIQUAD_LANES + l];
+                float y = b0 * x + z1;
+                z1 = b1 * x - a1 * y + z2;
+                z2 = b2 * x - a2 * y;
+                dst[i * BIQUAD_LANES + l] = y;
+                if constexpr (Interpolate) {
+                    b0 += deltas[l];
+                    b1 += deltas[BIQUAD_LANES + l];
+                    b2 += deltas[2 * BIQUAD_LANES + l];
+                    a1 += deltas[3 * BIQUAD_LANES + l];
+                    a2 += deltas[4 * BIQUAD_LANES + l];
+                }
+            }
+            if constexpr (Interpolate) {
+                coefficients[l] = b0;
+                coefficients[BIQUAD_LANES + l] = b1;
+                coefficients[2 * BIQUAD_LANES + l] = b2;
+                coefficients[3 * BIQUAD_LANES + l] = a1;
+                coefficients[4 * BIQUAD_LANES + l] = a2;
+            }
+            state[l] = z1;
+            state[BIQUAD_LANES + l] = z2;
+        }
+    }
+
+    inline void vbiquad(const float *src,
+                        float *dst,
+                        unsigned length,
+                        float *coefficients,
+                        const float *deltas,
+                        float *state,
+                        unsigned sections) {
+        for (unsigned s = 0; s < sections; s++) {
+            const float *section_src = s == 0 ? src : dst;
+            float *section_coefficients = coefficients + s * 5 * BIQUAD_LANES;
+            float *section_state = state + s * 2 * BIQUAD_LANES;
+            if (deltas) {
+                const float *section_deltas = deltas + s * 5 * BIQUAD_LANES;
+                biquad_section<true>(section_src, dst, length, section_coefficients, section_deltas, section_state);
+            } else {
+                biquad_section<false>(section_src, dst, length, section_coefficients, nullptr, section_state);
+            }
+        }
+    }
 } // namespace Dynamo::Vectorize::Scalar
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include <cmath>
+
+#include <Math/FFTPlan.hpp>
+#include <Math/Vectorize.hpp>
+#include <Utils/Bits.hpp>
+#include <Utils/Log.hpp>
+
+namespace Dynamo {
+    FFTPlan::FFTPlan(unsigned N) : _N(N) {
+        DYN_ASSERT((N & (N - 1)) == 0 && N >= 4);
+        unsigned bits = find_lsb(N);
+
+        _reverse.resize(N);
+        for (unsigned i = 0; i < N; i++) {
+            unsigned j = 0;
+            for (unsigned b = 0; b < bits; b++) {
+                j |= ((i >> b) & 1) << (bits - 1 - b);
+            }
+            _reverse[i] = j;
+        }
+
+        // Butterfly j of a stage with quarter length h twiddles b, c, and d by w^2j, w^j, and w^3j,
+        // where w = exp(-2 pi i / 4h)
+        _twiddles.resize(6 * (N / 2 - 1));
+        for (unsigned h = 1; h <= N / 4; h *= 2) {
+            float *twiddles = _twiddles.data() + 6 * (h - 1);
+            for (unsigned j = 0; j < h; j++) {
+                unsigned powers[3] = {2 * j, j, 3 * j};
+                for (unsigned t = 0; t < 3; t++) {
+                    double angle = -2 * M_PI * powers[t] / (4 * h);
+                    twiddles[2 * t * h + j] = std::cos(angle);
+                    twiddles[(2 * t + 1) * h + j] = std::sin(angle);
+                }
+            }
+        }
+
+        _real_re.resize(N / 4 + 1);
+        _real_im.resize(N / 4 + 1);
+        for (unsigned k = 0; k <= N / 4; k++) {
+            double angle = -2 * M_PI * k / N;
+            _real_re[k] = std::cos(angle);
+            _real_im[k] = std::sin(angle);
+        }
+    }
+
+    void FFTPlan::permute(float *re, float *im, unsigned n) const {
+        unsigned shift = n == _N ? 0 : 1;
+        for (unsigned i = 0; i < n; i++) {
+            unsigned j = _reverse[i] >> shift;
+            if (i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+    }
+
+    /**
+     * @brief Radix-4 butterfly without twiddles on the frames 0, stride, 2 * stride, and 3 * stride.
+     *
+     * @param re
+     * @param im
+     * @param stride
+     */
+    static inline void radix4(float *re, float *im, unsigned stride) {
+        float t0_re = re[0] + re[stride], t0_im = im[0] + im[stride];
+        float t1_re = re[0] - re[stride], t1_im = im[0] - im[stride];
+        float t2_re = re[2 * stride] + re[3 * stride], t2_im = im[2 * stride] + im[3 * stride];
+        float t3_re = re[2 * stride] - re[3 * stride], t3_im = im[2 * stride] - im[3 * stride];
+        re[0] = t0_re + t2_re;
+        im[0] = t0_im + t2_im;
+        re[stride] = t1_re + t3_im;
+        im[stride] = t1_im - t3_re;
+        re[2 * stride] = t0_re - t2_re;
+        im[2 * stride] = t0_im - t2_im;
+        re[3 * stride] = t1_re - t3_im;
+        im[3 * stride] = t1_im + t3_re;
+    }
+
+    /**
+     * @brief Radix-2 butterfly without twiddles on the frames 0 and 1.
+     *
+     * @param re
+     * @param im
+     */
+    static inline void radix2(float *re, float *im) {
+        float a_re = re[0];
+        float a_im = im[0];
+        re[0] = a_re + re[1];
+        im[0] = a_im + im[1];
+        re[1] = a_re - re[1];
+        im[1] = a_im - im[1];
+    }
+
+    void FFTPlan::butterflies(float *re, float *im, unsigned n) const {
+        // The first stages are too short to vectorize, but their twiddles are constant
+        unsigned h;
+        if (find_lsb(n) % 2 == 0) {
+            for (unsigned k = 0; k < n; k += 4) {
+                radix4(re + k, im + k, 1);
+            }
+            h = 4;
+        } else if (n == 2) {
+            radix2(re, im);
+            return;
+        } else {
+            // A radix-2 stage followed by a radix-4 stage whose second butterfly twiddles by -i,
+            // exp(-i pi / 4), and exp(-3i pi / 4)
+            constexpr float SQRT1_2 = 0.70710678f;
+            for (unsigned k = 0; k < n; k += 8) {
+                float *r = re + k;
+                float *i = im + k;
+                for (unsigned p = 0; p < 8; p += 2) {
+                    radix2(r + p, i + p);
+                }
+                float b_re = i[3], b_im = -r[3];
+                float c_re = SQRT1_2 * (r[5] + i[5]), c_im = SQRT1_2 * (i[5] - r[5]);
+                float d_re = SQRT1_2 * (i[7] - r[7]), d_im = -SQRT1_2 * (r[7] + i[7]);
+                r[3] = b_re;
+                i[3] = b_im;
+                r[5] = c_re;
+                i[5] = c_im;
+                r[7] = d_re;
+                i[7] = d_im;
+                radix4(r, i, 2);
+                radix4(r + 1, i + 1, 2);
+            }
+            h = 8;
+        }
+
+        // Radix-4 stages
+        for (; 4 * h <= n; h *= 4) {
+            const float *twiddles = _twiddles.data() + 6 * (h - 1);
+            for (unsigned k = 0; k < n; k += 4 * h) {
+                Vectorize::vradix4(re + k, im + k, twiddles, h, h);
+            }
+        }
+    }
+
+    unsigned FFTPlan::size() const { return _N; }
+
+    void FFTPlan::forward(float *re, float *im) const {
+        permute(re, im, _N);
+        butterflies(re, im, _N);
+    }
+
+    void FFTPlan::inverse(float *re, float *im) const {
+        permute(re, im, _N);
+        butterflies(im, re, _N);
+
+        // Normalize
+        float inv_N = 1.0 / _N;
+        Vectorize::smul(re, inv_N, re, _N);
+        Vectorize::smul(im, inv_N, im, _N);
+    }
+
+    void FFTPlan::forward_real(const float *signal, float *re, float *im) const {
+        unsigned half_N = _N >> 1;
+
+        // Pack even samples into the real part and odd samples into the imaginary part, already bit reversed
+        for (unsigned i = 0; i < half_N; i++) {
+            unsigned j = _reverse[i] >> 1;
+            re[j] = signal[2 * i];
+            im[j] = signal[2 * i + 1];
+        }
+        butterflies(re, im, half_N);
+
+        // Separate the even and odd spectra, combining them into the spectrum of the signal
+        float z_re = re[0];
+        float z_im = im[0];
+        re[0] = z_re + z_im;
+        im[0] = 0;
+        re[half_N] = z_re - z_im;
+        im[half_N] = 0;
+        for (unsigned k = 1; k <= half_N / 2; k++) {
+            float a_re = re[k];
+            float a_im = im[k];
+            float b_re = re[half_N - k];
+            float b_im = -im[half_N - k];
+            float even_re = (a_re + b_re) * 0.5f;
+            float even_im = (a_im + b_im) * 0.5f;
+
+            // odd = w * (a.im - b.im, b.re - a.re) / 2
+            float t_re = (a_im - b_im) * 0.5f;
+            float t_im = (b_re - a_re) * 0.5f;
+            float odd_re = _real_re[k] * t_re - _real_im[k] * t_im;
+            float odd_im = _real_re[k] * t_im + _real_im[k] * t_re;
+
+            re[k] = even_re + odd_re;
+            im[k] = even_im + odd_im;
+            re[half_N - k] = even_re - odd_re;
+            im[half_N - k] = odd_im - even_im;
+        }
+    }
+
+    void FFTPlan::inverse_real(float *re, float *im, float *signal) const {
+        unsigned half_N = _N >> 1;
+
+        // Recombine the even and odd spectra into a packed half-length spectrum
+        float x0 = re[0];
+        float xn = re[half_N];
+        re[0] = (x0 + xn) * 0.5f;
+        im[0] = (x0 - xn) * 0.5f;
+        for (unsigned k = 1; k <= half_N / 2; k++) {
+            float a_re = re[k];
+            float a_im = im[k];
+            float b_re = re[half_N - k];
+            float b_im = -im[half_N - k];
+            float even_re = (a_re + b_re) * 0.5f;
+            float even_im = (a_im + b_im) * 0.5f;
+
+            // odd = (a - b) * conj(w) / 2
+            float t_re = (a_re - b_re) * 0.5f;
+            float t_im = (a_im - b_im) * 0.5f;
+            float odd_re = t_re * _real_re[k] + t_im * _real_im[k];
+            float odd_im = t_im * _real_re[k] - t_re * _real_im[k];
+
+            // Z[k] = E[k] + jO[k], Z[N/2 - k] = conj(E[k]) + j conj(O[k])
+            re[k] = even_re - odd_im;
+            im[k] = even_im + odd_re;
+            re[half_N - k] = even_re + odd_im;
+            im[half_N - k] = odd_re - even_im;
+        }
+
+        // Inverse transform by swapping the real and imaginary parts
+        permute(re, im, half_N);
+        butterflies(im, re, half_N);
+
+        // Normalize and unpack the even and odd samples
+        float inv_half_N = 1.0 / half_N;
+        for (unsigned i = 0; i < half_N; i++) {
+            signal[2 * i] = re[i] * inv_half_N;
+            signal[2 * i + 1] = im[i] * inv_half_N;
+        }
+    }
+} // namespace Dynamo
\ No newline at end of file
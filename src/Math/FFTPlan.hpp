@@ -0,0 +1,120 @@
+#pragma once
+
+#include <vector>
+
+namespace Dynamo {
+    /**
+     * @brief Pre-computed tables for fast fourier transforms of a fixed size.
+     *
+     * Complex numbers are stored as separate arrays of real and imaginary
+     * parts so the butterflies can be vectorized. The bit reversal
+     * permutation and the twiddle factors of every stage are computed once,
+     * each directly from its angle so that no rounding error accumulates.
+     * Stages are computed with radix-4 butterflies, with a single radix-2
+     * stage first if the size is an odd power of 2.
+     *
+     * A plan is immutable after construction, so it can be shared between
+     * threads.
+     *
+     */
+    class FFTPlan {
+        unsigned _N;
+
+        /**
+         * @brief Bit reversal permutation of N indices.
+         *
+         * The permutation of N / 2 indices is the first half shifted right
+         * by one, which is used by the real transforms.
+         *
+         */
+        std::vector<unsigned> _reverse;
+
+        /**
+         * @brief Twiddle factors of the radix-4 stages for each quarter
+         * length h, stored at offset 6 * (h - 1).
+         *
+         */
+        std::vector<float> _twiddles;
+
+        /**
+         * @brief Twiddle factors that separate the even and odd spectra of
+         * the real transforms.
+         *
+         */
+        std::vector<float> _real_re;
+        std::vector<float> _real_im;
+
+        /**
+         * @brief Reorder a signal in place by the bit reversal permutation.
+         *
+         * @param re
+         * @param im
+         * @param n  Number of frames, N or N / 2
+         */
+        void permute(float *re, float *im, unsigned n) const;
+
+        /**
+         * @brief Run the butterflies of a forward transform on a bit reversed signal.
+         *
+         * Swapping the real and imaginary parts computes the unnormalized inverse instead.
+         *
+         * @param re
+         * @param im
+         * @param n  Number of frames, N or N / 2
+         */
+        void butterflies(float *re, float *im, unsigned n) const;
+
+      public:
+        /**
+         * @brief Construct a new FFTPlan object.
+         *
+         * @param N Number of frames of a transform (must be a power of 2 and at least 4)
+         */
+        FFTPlan(unsigned N);
+
+        /**
+         * @brief Get the number of frames of a transform.
+         *
+         * @return unsigned
+         */
+        unsigned size() const;
+
+        /**
+         * @brief Fourier transform of a complex signal in-place.
+         *
+         * @param re Real parts of N frames
+         * @param im Imaginary parts of N frames
+         */
+        void forward(float *re, float *im) const;
+
+        /**
+         * @brief Normalized inverse fourier transform of a complex spectrum in-place.
+         *
+         * @param re Real parts of N frequency bins
+         * @param im Imaginary parts of N frequency bins
+         */
+        void inverse(float *re, float *im) const;
+
+        /**
+         * @brief Fourier transform of a real signal.
+         *
+         * This packs the signal into a complex signal of half the length, so
+         * only the non-redundant half of the spectrum is computed.
+         *
+         * @param signal Real signal of N frames
+         * @param re     Destination real parts of N / 2 + 1 frequency bins
+         * @param im     Destination imaginary parts of N / 2 + 1 frequency bins
+         */
+        void forward_real(const float *signal, float *re, float *im) const;
+
+        /**
+         * @brief Inverse of forward_real, computing a real signal from the
+         * non-redundant half of its spectrum.
+         *
+         * @param re     Real parts of N / 2 + 1 frequency bins, overwritten
+         * @param im     Imaginary parts of N / 2 + 1 frequency bins, overwritten
+         * @param signal Destination real signal of N frames
+         */
+        void inverse_real(float *re, float *im, float *signal) const;
+    };
+} // namespace Dynamo
\ No newline at end of file
@@ -86,4 +86,212 @@ namespace Dynamo::Vectorize {
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         arch::vclamp(src, lo, hi, dst, length);
     }
+
+    /**
+     * @brief dst[i] = src[i] * scalar, converting 16-bit integers to floats
+     *
+     * @param src
+     * @param scalar
+     * @param dst
+     * @param length
+     */
+    inline void vconvert_s16(const int16_t *src, const float scalar, float *dst, unsigned length) {
+        arch::vconvert_s16(src, scalar, dst, length);
+    }
+
+    /**
+     * @brief dst[i] = src[i] * scalar, converting packed little-endian 24-bit integers to floats
+     *
+     * @param src    3 * length bytes
+     * @param scalar
+     * @param dst
+     * @param length
+     */
+    inline void vconvert_s24(const uint8_t *src, const float scalar, float *dst, unsigned length) {
+        arch::vconvert_s24(src, scalar, dst, length);
+    }
+
+    /**
+     * @brief dst[i] = src[i] * scalar, converting 32-bit integers to floats
+     *
+     * @param src
+     * @param scalar
+     * @param dst
+     * @param length
+     */
+    inline void vconvert_s32(const int32_t *src, const float scalar, float *dst, unsigned length) {
+        arch::vconvert_s32(src, scalar, dst, length);
+    }
+
+    /**
+     * @brief dst[i] = round(src[i] * scalar + dither[i]), saturated to 16-bit integers
+     *
+     * The dither is noise in units of the least significant bit, such as
+     * triangular noise in (-1, 1), or nullptr to only round.
+     *
+     * @param src
+     * @param scalar
+     * @param dither
+     * @param dst
+     * @param length
+     */
+    inline void vquantize_s16(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int16_t *dst,
+                              unsigned length) {
+        arch::vquantize_s16(src, scalar, dither, dst, length);
+    }
+
+    /**
+     * @brief dst[i] = round(src[i] * scalar + dither[i]), saturated to packed
+     * little-endian 24-bit integers
+     *
+     * @param src
+     * @param scalar
+     * @param dither Noise in units of the least significant bit or nullptr
+     * @param dst    3 * length bytes
+     * @param length
+     */
+    inline void vquantize_s24(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              uint8_t *dst,
+                              unsigned length) {
+        arch::vquantize_s24(src, scalar, dither, dst, length);
+    }
+
+    /**
+     * @brief dst[i] = round(src[i] * scalar + dither[i]), saturated to 32-bit integers
+     *
+     * @param src
+     * @param scalar
+     * @param dither Noise in units of the least significant bit or nullptr
+     * @param dst
+     * @param length
+     */
+    inline void vquantize_s32(const float *src,
+                              const float scalar,
+                              const float *dither,
+                              int32_t *dst,
+                              unsigned length) {
+        arch::vquantize_s32(src, scalar, dither, dst, length);
+    }
+
+    /**
+     * @brief dst[f * channels + c] = src[c * stride + f]
+     *
+     * Mono, stereo, and quad are vectorized.
+     *
+     * @param src      Channels stored one after the other
+     * @param stride   Distance between the channels of src
+     * @param channels
+     * @param dst      Interleaved frames
+     * @param length   Number of frames
+     */
+    inline void vinterleave(const float *src, unsigned stride, unsigned channels, float *dst, unsigned length) {
+        arch::vinterleave(src, stride, channels, dst, length);
+    }
+
+    /**
+     * @brief dst[c * stride + f] = src[f * channels + c]
+     *
+     * Mono, stereo, and quad are vectorized.
+     *
+     * @param src      Interleaved frames
+     * @param channels
+     * @param dst      Channels stored one after the other
+     * @param stride   Distance between the channels of dst
+     * @param length   Number of frames
+     */
+    inline void vdeinterleave(const float *src, unsigned channels, float *dst, unsigned stride, unsigned length) {
+        arch::vdeinterleave(src, channels, dst, stride, length);
+    }
+
+    /**
+     * @brief sum(src_a[i] * src_b[i])
+     *
+     * @param src_a
+     * @param src_b
+     * @param length
+     * @return float
+     */
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        return arch::vdot(src_a, src_b, length);
+    }
+
+    /**
+     * @brief dst[i] += src_a[i] * src_b[i] on complex numbers stored as
+     * separate real and imaginary arrays
+     *
+     * @param src_a_re
+     * @param src_a_im
+     * @param src_b_re
+     * @param src_b_im
+     * @param dst_re
+     * @param dst_im
+     * @param length
+     */
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        arch::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, length);
+    }
+
+    /**
+     * @brief Radix-4 decimation-in-time butterflies on complex numbers
+     * stored as separate real and imaginary arrays
+     *
+     * Butterfly j combines the inputs a, b, c, d at j, j + stride,
+     * j + 2 * stride, and j + 3 * stride. The twiddle factors of b, c, and d
+     * are given as 6 arrays, the real then imaginary parts of each, spaced
+     * stride apart. The outputs are a + b + c + d, a - b - i(c - d),
+     * a + b - c - d, and a - b + i(c - d) after twiddling.
+     *
+     * @param re
+     * @param im
+     * @param twiddles
+     * @param stride
+     * @param length   Number of butterflies, at most stride
+     */
+    inline void vradix4(float *re, float *im, const float *twiddles, unsigned stride, unsigned length) {
+        arch::vradix4(re, im, twiddles, stride, length);
+    }
+
+    /**
+     * @brief Number of signals filtered at once by vbiquad
+     *
+     */
+    static constexpr unsigned BIQUAD_LANES = arch::BIQUAD_LANES;
+
+    /**
+     * @brief Run a cascade of biquad sections on BIQUAD_LANES interleaved
+     * signals at once, where sample i of lane l is at src[i * BIQUAD_LANES + l]
+     *
+     * Each section holds the coefficients b0, b1, b2, a1, a2 and the
+     * transposed direct form II state z1, z2 as consecutive vectors of
+     * BIQUAD_LANES values. If deltas is not null, it is added to the
+     * coefficients after every sample.
+     *
+     * @param src
+     * @param dst          Destination, may be equal to src
+     * @param length       Number of samples per lane
+     * @param coefficients 5 * BIQUAD_LANES coefficients per section, updated if interpolated
+     * @param deltas       5 * BIQUAD_LANES coefficient increments per section or nullptr
+     * @param state        2 * BIQUAD_LANES state variables per section
+     * @param sections     Number of sections
+     */
+    inline void vbiquad(const float *src,
+                        float *dst,
+                        unsigned length,
+                        float *coefficients,
+                        const float *deltas,
+                        float *state,
+                        unsigned sections) {
+        arch::vbiquad(src, dst, length, coefficients, deltas, state, sections);
+    }
 } // namespace Dynamo::Vectorize
\ No newline at end of file
@@ -12,33 +12,36 @@ namespace Dynamo::Sound {
         Vectorize::vsma(src[src_channel], scalar, dst[dst_channel], src.frames());
     }
 
-    Buffer::Buffer(unsigned frames, unsigned channels) : _frames(frames), _channels(channels) {
-        unsigned length = std::max(frames * channels, 1U);
-        _samples = new (std::align_val_t(64)) WaveSample[length];
+    Buffer::Buffer(unsigned frames, unsigned channels, double sample_rate) :
+        _frames(frames), _channels(channels), _sample_rate(sample_rate) {
+        _capacity = std::max(frames * channels, 1U);
+        _samples = new (std::align_val_t(64)) WaveSample[_capacity];
     }
 
-    Buffer::Buffer(WaveSample *samples, unsigned frames, unsigned channels) : Buffer(frames, channels) {
+    Buffer::Buffer(WaveSample *samples, unsigned frames, unsigned channels, double sample_rate) :
+        Buffer(frames, channels, sample_rate) {
         std::copy(samples, samples + (_frames * _channels), _samples);
     }
 
-    Buffer::Buffer(const Buffer &rhs) : Buffer(rhs._frames, rhs._channels) {
+    Buffer::Buffer(const Buffer &rhs) : Buffer(rhs._frames, rhs._channels, rhs._sample_rate) {
         std::copy(rhs._samples, rhs._samples + (_frames * _channels), _samples);
     }
 
     Buffer::~Buffer() { delete[] _samples; }
 
     Buffer &Buffer::operator=(const Buffer &rhs) {
-        unsigned prev_size = _frames * _channels;
         unsigned next_size = rhs._frames * rhs._channels;
 
         // Reallocate the sample container if necessary
-        if (next_size > prev_size) {
+        if (next_size > _capacity) {
             delete[] _samples;
             _samples = new (std::align_val_t(64)) WaveSample[next_size];
+            _capacity = next_size;
         }
 
         _frames = rhs._frames;
         _channels = rhs._channels;
+        _sample_rate = rhs._sample_rate;
         std::copy(rhs._samples, rhs._samples + next_size, _samples);
 
         return *this;
@@ -62,16 +65,20 @@ namespace Dynamo::Sound {
 
     unsigned Buffer::channels() const { return _channels; }
 
+    double Buffer::sample_rate() const { return _sample_rate; }
+
+    void Buffer::set_sample_rate(double sample_rate) { _sample_rate = sample_rate; }
+
     void Buffer::silence() { std::fill(_samples, _samples + (_frames * _channels), 0); }
 
     void Buffer::resize(const unsigned frames, const unsigned channels) {
-        unsigned prev_size = _frames * _channels;
         unsigned next_size = frames * channels;
 
         // Reallocate the sample container if necessary
-        if (next_size > prev_size) {
+        if (next_size > _capacity) {
             delete[] _samples;
             _samples = new (std::align_val_t(64)) WaveSample[next_size];
+            _capacity = next_size;
         }
 
         _frames = frames;
@@ -39,29 +39,37 @@ namespace Dynamo::Sound {
     /**
      * @brief Deinterleaved multi-channel buffer for WaveSamples.
      *
+     * Samples are stored at their native sample rate, and the mixer resamples
+     * them to the device sample rate in a single pass.
+     *
      */
     class Buffer {
         WaveSample *_samples;
 
         unsigned _frames;
         unsigned _channels;
+        unsigned _capacity;
+
+        double _sample_rate;
 
       public:
         /**
          * @brief Construct an empty Buffer.
          *
-         * @param frames   Number of frames.
-         * @param channels Number of channels.
+         * @param frames      Number of frames.
+         * @param channels    Number of channels.
+         * @param sample_rate Sample rate.
          */
-        Buffer(unsigned frames = 0, unsigned channels = 0);
+        Buffer(unsigned frames = 0, unsigned channels = 0, double sample_rate = STANDARD_SAMPLE_RATE);
 
         /**
          * @brief Construct a Buffer with an existing sample array.
          *
-         * @param data     Data buffer.
-         * @param channels Number of channels.
+         * @param data        Data buffer.
+         * @param channels    Number of channels.
+         * @param sample_rate Sample rate.
          */
-        Buffer(WaveSample *samples, unsigned frames, unsigned channels);
+        Buffer(WaveSample *samples, unsigned frames, unsigned channels, double sample_rate = STANDARD_SAMPLE_RATE);
 
         /**
          * @brief Copy constructor.
@@ -128,6 +136,22 @@ namespace Dynamo::Sound {
          */
         unsigned channels() const;
 
+        /**
+         * @brief Get the sample rate.
+         *
+         * @return double
+         */
+        double sample_rate() const;
+
+        /**
+         * @brief Set the sample rate.
+         *
+         * This does not resample the existing data.
+         *
+         * @param sample_rate
+         */
+        void set_sample_rate(double sample_rate);
+
         /**
          * @brief Silence the buffer.
          *
@@ -137,7 +161,8 @@ namespace Dynamo::Sound {
         /**
          * @brief Resize the container to fit a number of frames and channels.
          *
-         * This will not preserve the existing data.
+         * This will not preserve the existing data. Memory is only reallocated
+         * if the new size exceeds the largest size held so far.
          *
          * @param frames   Number of frames.
          * @param channels Number of channels.
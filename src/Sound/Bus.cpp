@@ -0,0 +1,10 @@
+#include <Sound/Bus.hpp>
+
+namespace Dynamo::Sound {
+    Bus::Bus(std::optional<FilterRef> filter, unsigned channels) :
+        _filter(filter), _channels(channels), _source(_silence) {}
+
+    void Bus::set_filter(std::optional<FilterRef> filter) { _filter = filter; }
+
+    void Bus::set_output(std::optional<std::reference_wrapper<Bus>> bus) { _output = bus; }
+} // namespace Dynamo::Sound
\ No newline at end of file
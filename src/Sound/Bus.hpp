@@ -0,0 +1,80 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/Filter.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Submix bus that sums the sources and buses routed into it and
+     * runs its filter once on the result.
+     *
+     * Buses feed the master output unless routed into another bus. Effects
+     * shared by many sources, like reverb, should run on a bus rather than
+     * on every source.
+     *
+     * Inputs are summed in the channel layout of the bus, which is the layout
+     * of the output device by default. A bus with another layout, e.g., an
+     * ambisonic bus, needs a filter that converts it for its output.
+     *
+     * A bus must be added to the Jukebox to be processed. Sources and buses
+     * routed into a bus that is not added are not heard.
+     *
+     * The filter, output, and volume are copied by the Jukebox on commit,
+     * so changes take effect from the next commit.
+     *
+     */
+    class Bus {
+        std::optional<FilterRef> _filter;
+        unsigned _channels;
+        std::optional<std::reference_wrapper<Bus>> _output;
+
+        /**
+         * @brief Source presented to the filter, placed at the listener.
+         *
+         * It is never played, so its audio is left empty.
+         *
+         */
+        Buffer _silence;
+        Source _source;
+
+        friend class Jukebox;
+
+      public:
+        /**
+         * @brief Volume multiplier of the bus output.
+         *
+         */
+        float volume = 1;
+
+        /**
+         * @brief Construct a new Bus object.
+         *
+         * @param filter
+         * @param channels Number of channels the inputs are summed in, or 0 for the output device channels
+         */
+        Bus(std::optional<FilterRef> filter = {}, unsigned channels = 0);
+
+        /**
+         * @brief Set the filter applied to the summed input.
+         *
+         * A filter should only be used by a single bus or source, since it
+         * may keep state between chunks.
+         *
+         * @param filter
+         */
+        void set_filter(std::optional<FilterRef> filter);
+
+        /**
+         * @brief Set the bus this bus is mixed into, or the master if empty.
+         *
+         * @param bus
+         */
+        void set_output(std::optional<std::reference_wrapper<Bus>> bus);
+    };
+
+    using BusRef = std::reference_wrapper<Bus>;
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include <Math/Vectorize.hpp>
+#include <Sound/CompressedBuffer.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Quantization step of each IMA-ADPCM step index
+     *
+     */
+    static constexpr std::array<int, 89> ADPCM_STEPS = {
+        7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+        31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+        130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+        544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+        2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+        9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+    };
+
+    /**
+     * @brief Change of the step index after each code
+     *
+     */
+    static constexpr std::array<int, 16> ADPCM_INDEX_DELTAS = {
+        -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8,
+    };
+
+    /**
+     * @brief Scale from 16-bit samples to WaveSamples
+     *
+     */
+    static constexpr float INT16_SCALE = 1.0f / 32768;
+
+    /**
+     * @brief State of the IMA-ADPCM predictor.
+     *
+     */
+    struct ADPCMState {
+        int predictor = 0;
+        int index = 0;
+
+        /**
+         * @brief Decode a 4-bit code and update the state.
+         *
+         * @param code
+         * @return int Decoded sample
+         */
+        inline int decode(unsigned code) {
+            int step = ADPCM_STEPS[index];
+            int delta = step >> 3;
+            if (code & 4) delta += step;
+            if (code & 2) delta += step >> 1;
+            if (code & 1) delta += step >> 2;
+            predictor = std::clamp(code & 8 ? predictor - delta : predictor + delta, -32768, 32767);
+            index = std::clamp(index + ADPCM_INDEX_DELTAS[code], 0, 88);
+            return predictor;
+        }
+
+        /**
+         * @brief Encode a sample as a 4-bit code and update the state.
+         *
+         * @param sample
+         * @return unsigned
+         */
+        inline unsigned encode(int sample) {
+            int step = ADPCM_STEPS[index];
+            int difference = sample - predictor;
+            unsigned code = 0;
+            if (difference < 0) {
+                code = 8;
+                difference = -difference;
+            }
+            for (unsigned bit = 4; bit > 0; bit >>= 1) {
+                if (difference >= step) {
+                    code |= bit;
+                    difference -= step;
+                }
+                step >>= 1;
+            }
+
+            // Track the decoder so that rounding errors do not accumulate
+            decode(code);
+            return code;
+        }
+    };
+
+    /**
+     * @brief Quantize a WaveSample to a 16-bit integer.
+     *
+     * @param sample
+     * @return int16_t
+     */
+    static int16_t quantize(WaveSample sample) {
+        return std::clamp(std::round(sample * 32768.0f), -32768.0f, 32767.0f);
+    }
+
+    CompressedBuffer::CompressedBuffer(const Buffer &buffer, SampleFormat format) :
+        _format(format), _frames(buffer.frames()), _channels(buffer.channels()),
+        _blocks((_frames + ADPCM_BLOCK_LENGTH - 1) / ADPCM_BLOCK_LENGTH), _sample_rate(buffer.sample_rate()) {
+        switch (_format) {
+        case SampleFormat::Int16:
+            _pcm.resize(_frames * _channels);
+            for (unsigned c = 0; c < _channels; c++) {
+                Vectorize::vquantize_s16(buffer[c], 32768, nullptr, _pcm.data() + c * _frames, _frames);
+            }
+            break;
+        case SampleFormat::ADPCM:
+            _adpcm.resize(_blocks * _channels * ADPCM_BLOCK_SIZE, 0);
+            for (unsigned c = 0; c < _channels; c++) {
+                ADPCMState state;
+                for (unsigned b = 0; b < _blocks; b++) {
+                    unsigned start = b * ADPCM_BLOCK_LENGTH;
+                    unsigned count = std::min(ADPCM_BLOCK_LENGTH, _frames - start);
+
+                    // The step index adapts slowly to sudden onsets, so each block starts from the one with
+                    // the least error
+                    int64_t best_error = INT64_MAX;
+                    for (int index = 0; index < static_cast<int>(ADPCM_STEPS.size()); index++) {
+                        ADPCMState trial = {state.predictor, index};
+                        int64_t error = 0;
+                        for (unsigned f = 0; f < count && error < best_error; f++) {
+                            int sample = quantize(buffer[c][start + f]);
+                            trial.encode(sample);
+                            error += static_cast<int64_t>(trial.predictor - sample) * (trial.predictor - sample);
+                        }
+                        if (error < best_error) {
+                            best_error = error;
+                            state.index = index;
+                        }
+                    }
+
+                    // The header restores the predictor state, so each block can be decoded on its own
+                    uint8_t *block = _adpcm.data() + (c * _blocks + b) * ADPCM_BLOCK_SIZE;
+                    block[0] = state.predictor & 0xff;
+                    block[1] = (state.predictor >> 8) & 0xff;
+                    block[2] = state.index;
+
+                    // Two codes per byte, the earlier frame in the low nibble
+                    for (unsigned f = 0; f < count; f++) {
+                        unsigned code = state.encode(quantize(buffer[c][start + f]));
+                        block[4 + f / 2] |= code << (4 * (f % 2));
+                    }
+                }
+            }
+            break;
+        }
+    }
+
+    void CompressedBuffer::decode_block(unsigned channel,
+                                        unsigned block,
+                                        unsigned first,
+                                        unsigned count,
+                                        WaveSample *dst) const {
+        const uint8_t *data = _adpcm.data() + (channel * _blocks + block) * ADPCM_BLOCK_SIZE;
+        ADPCMState state;
+        state.predictor = static_cast<int16_t>(data[0] | (data[1] << 8));
+        state.index = data[2];
+
+        // The predictor depends on every previous code, so the frames before the range are decoded and discarded
+        const uint8_t *codes = data + 4;
+        for (unsigned f = 0; f < first; f++) {
+            state.decode((codes[f / 2] >> (4 * (f % 2))) & 0xf);
+        }
+        for (unsigned f = first; f < first + count; f++) {
+            *dst++ = state.decode((codes[f / 2] >> (4 * (f % 2))) & 0xf) * INT16_SCALE;
+        }
+    }
+
+    SampleFormat CompressedBuffer::format() const { return _format; }
+
+    unsigned CompressedBuffer::frames() const { return _frames; }
+
+    unsigned CompressedBuffer::channels() const { return _channels; }
+
+    double CompressedBuffer::sample_rate() const { return _sample_rate; }
+
+    unsigned CompressedBuffer::size() const { return _pcm.size() * sizeof(int16_t) + _adpcm.size(); }
+
+    void CompressedBuffer::decode(unsigned first, Buffer &dst) const {
+        DYN_ASSERT(dst.channels() == _channels);
+        unsigned count = first < _frames ? std::min(dst.frames(), _frames - first) : 0;
+        for (unsigned c = 0; c < _channels; c++) {
+            switch (_format) {
+            case SampleFormat::Int16:
+                Vectorize::vconvert_s16(_pcm.data() + c * _frames + std::min(first, _frames),
+                                        INT16_SCALE,
+                                        dst[c],
+                                        count);
+                break;
+            case SampleFormat::ADPCM:
+                for (unsigned f = 0; f < count;) {
+                    unsigned frame = first + f;
+                    unsigned offset = frame % ADPCM_BLOCK_LENGTH;
+                    unsigned length = std::min(ADPCM_BLOCK_LENGTH - offset, count - f);
+                    decode_block(c, frame / ADPCM_BLOCK_LENGTH, offset, length, dst[c] + f);
+                    f += length;
+                }
+                break;
+            }
+            std::fill(dst[c] + count, dst[c] + dst.frames(), 0);
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
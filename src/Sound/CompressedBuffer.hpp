@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <Sound/Buffer.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of frames of a channel in an ADPCM block.
+     *
+     */
+    static constexpr unsigned ADPCM_BLOCK_LENGTH = 256;
+
+    /**
+     * @brief Size of an ADPCM block in bytes, with a 4 byte header and 4 bits per frame.
+     *
+     */
+    static constexpr unsigned ADPCM_BLOCK_SIZE = 4 + ADPCM_BLOCK_LENGTH / 2;
+
+    /**
+     * @brief Storage format of a compressed buffer.
+     *
+     */
+    enum class SampleFormat {
+        /**
+         * @brief 16-bit PCM, half the size of float samples.
+         *
+         */
+        Int16,
+
+        /**
+         * @brief IMA-ADPCM with 4 bits per sample in independently decodable
+         * blocks, about a quarter of the size of float samples.
+         *
+         */
+        ADPCM,
+    };
+
+    /**
+     * @brief Read-only multi-channel sound held in a compact sample format
+     * and decoded to floats on demand.
+     *
+     * Like Buffer, samples are kept at their native sample rate. ADPCM is
+     * decoded from the start of a block, so random access decodes up to a
+     * block of extra frames.
+     *
+     */
+    class CompressedBuffer {
+        SampleFormat _format;
+
+        unsigned _frames;
+        unsigned _channels;
+        unsigned _blocks;
+        double _sample_rate;
+
+        /**
+         * @brief Samples of each channel stored one after the other, either
+         * as 16-bit integers or as ADPCM blocks.
+         *
+         */
+        std::vector<int16_t> _pcm;
+        std::vector<uint8_t> _adpcm;
+
+        /**
+         * @brief Decode frames of a channel from an ADPCM block.
+         *
+         * @param channel Channel index
+         * @param block   Block index
+         * @param first   First frame within the block
+         * @param count   Number of frames
+         * @param dst     Destination
+         */
+        void decode_block(unsigned channel, unsigned block, unsigned first, unsigned count, WaveSample *dst) const;
+
+      public:
+        /**
+         * @brief Compress a buffer.
+         *
+         * @param buffer Source buffer
+         * @param format Sample format
+         */
+        CompressedBuffer(const Buffer &buffer, SampleFormat format);
+
+        /**
+         * @brief Get the sample format.
+         *
+         * @return SampleFormat
+         */
+        SampleFormat format() const;
+
+        /**
+         * @brief Get the number of frames.
+         *
+         * @return unsigned
+         */
+        unsigned frames() const;
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the sample rate.
+         *
+         * @return double
+         */
+        double sample_rate() const;
+
+        /**
+         * @brief Get the size of the compressed samples in bytes.
+         *
+         * @return unsigned
+         */
+        unsigned size() const;
+
+        /**
+         * @brief Decode a range of frames into a buffer.
+         *
+         * Frames past the end of the sound are silent. This is thread-safe.
+         *
+         * @param first First frame to decode
+         * @param dst   Destination buffer with the same number of channels,
+         *              decoding as many frames as it holds
+         */
+        void decode(unsigned first, Buffer &dst) const;
+    };
+
+    using CompressedBufferRef = std::reference_wrapper<CompressedBuffer>;
+} // namespace Dynamo::Sound
\ No newline at end of file
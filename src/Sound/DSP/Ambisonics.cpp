@@ -0,0 +1,133 @@
+#define _USE_MATH_DEFINES
+#include <cmath>
+
+#include <Sound/DSP/Ambisonics.hpp>
+#include <Utils/Log.hpp>
+
+namespace Dynamo::Sound {
+    Vec3 sphere_point(unsigned index, unsigned count) {
+        double z = 1 - (2 * index + 1.0) / count;
+        double r = std::sqrt(1 - z * z);
+        double phi = index * M_PI * (3 - std::sqrt(5.0));
+        return Vec3(r * std::cos(phi), r * std::sin(phi), z);
+    }
+
+    void ambisonic_gains(const Vec3 &direction, unsigned order, float *dst) {
+        DYN_ASSERT(order <= AMBISONIC_MAX_ORDER);
+        unsigned channels = ambisonic_channels(order);
+        dst[0] = 1;
+
+        float length = direction.length();
+        if (length == 0) {
+            std::fill(dst + 1, dst + channels, 0);
+            return;
+        }
+        float x = direction.x / length;
+        float y = direction.y / length;
+        float z = direction.z / length;
+
+        if (order >= 1) {
+            dst[1] = y;
+            dst[2] = z;
+            dst[3] = x;
+        }
+        if (order >= 2) {
+            constexpr float sqrt3 = 1.7320508f;
+            dst[4] = sqrt3 * x * y;
+            dst[5] = sqrt3 * y * z;
+            dst[6] = 0.5f * (3 * z * z - 1);
+            dst[7] = sqrt3 * x * z;
+            dst[8] = 0.5f * sqrt3 * (x * x - y * y);
+        }
+        if (order >= 3) {
+            constexpr float sqrt5_8 = 0.7905694f;
+            constexpr float sqrt15 = 3.8729833f;
+            constexpr float sqrt3_8 = 0.6123724f;
+            dst[9] = sqrt5_8 * y * (3 * x * x - y * y);
+            dst[10] = sqrt15 * x * y * z;
+            dst[11] = sqrt3_8 * y * (5 * z * z - 1);
+            dst[12] = 0.5f * z * (5 * z * z - 3);
+            dst[13] = sqrt3_8 * x * (5 * z * z - 1);
+            dst[14] = 0.5f * sqrt15 * z * (x * x - y * y);
+            dst[15] = sqrt5_8 * x * (x * x - 3 * y * y);
+        }
+    }
+
+    AmbisonicRotation::AmbisonicRotation(unsigned order) : _order(order), _channels(ambisonic_channels(order)) {
+        DYN_ASSERT(order <= AMBISONIC_MAX_ORDER);
+
+        // Spread the sample directions over the sphere, which keeps the encoding matrix well conditioned
+        unsigned n = _channels;
+        std::vector<float> gains(n);
+        std::vector<double> encoded(n * n);
+        for (unsigned i = 0; i < n; i++) {
+            _points.push_back(sphere_point(i, n));
+
+            ambisonic_gains(_points[i], order, gains.data());
+            for (unsigned k = 0; k < n; k++) {
+                encoded[k * n + i] = gains[k];
+            }
+        }
+
+        // Invert the encoding matrix with Gauss-Jordan elimination
+        _inverse.assign(n * n, 0);
+        for (unsigned i = 0; i < n; i++) {
+            _inverse[i * n + i] = 1;
+        }
+        for (unsigned col = 0; col < n; col++) {
+            unsigned pivot = col;
+            for (unsigned row = col + 1; row < n; row++) {
+                if (std::abs(encoded[row * n + col]) > std::abs(encoded[pivot * n + col])) {
+                    pivot = row;
+                }
+            }
+            DYN_ASSERT(std::abs(encoded[pivot * n + col]) > 1e-9);
+            for (unsigned k = 0; k < n; k++) {
+                std::swap(encoded[col * n + k], encoded[pivot * n + k]);
+                std::swap(_inverse[col * n + k], _inverse[pivot * n + k]);
+            }
+
+            double scale = 1 / encoded[col * n + col];
+            for (unsigned k = 0; k < n; k++) {
+                encoded[col * n + k] *= scale;
+                _inverse[col * n + k] *= scale;
+            }
+            for (unsigned row = 0; row < n; row++) {
+                double factor = encoded[row * n + col];
+                if (row == col || factor == 0) continue;
+                for (unsigned k = 0; k < n; k++) {
+                    encoded[row * n + k] -= factor * encoded[col * n + k];
+                    _inverse[row * n + k] -= factor * _inverse[col * n + k];
+                }
+            }
+        }
+        _rotated.resize(n * n);
+    }
+
+    void AmbisonicRotation::compute(const Quaternion &rotation, float *matrix) {
+        unsigned n = _channels;
+
+        // Each row projects world axes onto a listener axis
+        Vec3 forward = to_ambisonic(rotation.forward());
+        Vec3 left = to_ambisonic(rotation.right() * -1);
+        Vec3 up = to_ambisonic(rotation.up());
+
+        // Encode the rotated sample directions
+        for (unsigned i = 0; i < n; i++) {
+            const Vec3 &p = _points[i];
+            Vec3 q(forward * p, left * p, up * p);
+            ambisonic_gains(q, _order, _rotated.data() + i * n);
+        }
+
+        // The rotation maps the encoded directions to the encoded rotated directions
+        for (unsigned row = 0; row < n; row++) {
+            for (unsigned col = 0; col < n; col++) {
+                double sum = 0;
+                for (unsigned i = 0; i < n; i++) {
+                    sum += _rotated[i * n + row] * _inverse[i * n + col];
+                }
+                matrix[row * n + col] = sum;
+            }
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+
+#include <Math/Quaternion.hpp>
+#include <Math/Vec3.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Highest supported ambisonic order
+     *
+     */
+    static constexpr unsigned AMBISONIC_MAX_ORDER = 3;
+
+    /**
+     * @brief Get the number of channels of an ambisonic signal.
+     *
+     * @param order Ambisonic order
+     * @return constexpr unsigned
+     */
+    constexpr unsigned ambisonic_channels(unsigned order) { return (order + 1) * (order + 1); }
+
+    /**
+     * @brief Convert a vector from the engine axes (x right, y up, z forward)
+     * to the ambisonic axes (x forward, y left, z up).
+     *
+     * @param v
+     * @return Vec3
+     */
+    inline Vec3 to_ambisonic(const Vec3 &v) { return Vec3(v.z, -v.x, v.y); }
+
+    /**
+     * @brief Get a point of a spiral that spreads a number of points evenly
+     * over the unit sphere.
+     *
+     * @param index Index of the point
+     * @param count Number of points
+     * @return Vec3
+     */
+    Vec3 sphere_point(unsigned index, unsigned count);
+
+    /**
+     * @brief Compute the encoding gains of a direction in ambisonic axes.
+     *
+     * Channels are in ACN order with SN3D normalization, so the first
+     * channel always has unit gain. A zero direction is only encoded into
+     * the first channel.
+     *
+     * @param direction Direction, need not be normalized
+     * @param order     Ambisonic order
+     * @param dst       Destination with ambisonic_channels(order) gains
+     */
+    void ambisonic_gains(const Vec3 &direction, unsigned order, float *dst);
+
+    /**
+     * @brief Computes the matrix that rotates an ambisonic signal from world
+     * axes to the axes of a listener.
+     *
+     * The matrix is found by encoding a fixed set of directions before and
+     * after rotating them, which is exact since each order of the spherical
+     * harmonics rotates independently.
+     *
+     */
+    class AmbisonicRotation {
+        unsigned _order;
+        unsigned _channels;
+
+        std::vector<Vec3> _points;
+        std::vector<double> _inverse;
+        std::vector<float> _rotated;
+
+      public:
+        /**
+         * @brief Construct a new AmbisonicRotation object.
+         *
+         * @param order Ambisonic order
+         */
+        AmbisonicRotation(unsigned order = 1);
+
+        /**
+         * @brief Compute the rotation matrix for a listener orientation.
+         *
+         * @param rotation Orientation of the listener
+         * @param matrix   Destination row-major matrix with ambisonic_channels(order)^2 elements
+         */
+        void compute(const Quaternion &rotation, float *matrix);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
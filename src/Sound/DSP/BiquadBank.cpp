@@ -0,0 +1,197 @@
+#include <Sound/DSP/BiquadBank.hpp>
+#include <Sound/Jukebox.hpp>
+#include <Utils/Log.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of coefficients of a section
+     *
+     */
+    static constexpr unsigned SECTION_COEFFICIENTS = 5;
+
+    /**
+     * @brief Number of state variables of a section
+     *
+     */
+    static constexpr unsigned SECTION_STATE = 2;
+
+    /**
+     * @brief Normalize the raw cookbook coefficients by a0.
+     *
+     * @return BiquadCoefficients
+     */
+    static BiquadCoefficients normalize(double b0, double b1, double b2, double a0, double a1, double a2) {
+        BiquadCoefficients coefficients;
+        coefficients.b0 = b0 / a0;
+        coefficients.b1 = b1 / a0;
+        coefficients.b2 = b2 / a0;
+        coefficients.a1 = a1 / a0;
+        coefficients.a2 = a2 / a0;
+        return coefficients;
+    }
+
+    BiquadCoefficients BiquadCoefficients::lowpass(double frequency, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double alpha = std::sin(w0) / (2 * q);
+        return normalize((1 - cos_w0) / 2, 1 - cos_w0, (1 - cos_w0) / 2, 1 + alpha, -2 * cos_w0, 1 - alpha);
+    }
+
+    BiquadCoefficients BiquadCoefficients::highpass(double frequency, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double alpha = std::sin(w0) / (2 * q);
+        return normalize((1 + cos_w0) / 2, -(1 + cos_w0), (1 + cos_w0) / 2, 1 + alpha, -2 * cos_w0, 1 - alpha);
+    }
+
+    BiquadCoefficients BiquadCoefficients::bandpass(double frequency, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double alpha = std::sin(w0) / (2 * q);
+        return normalize(alpha, 0, -alpha, 1 + alpha, -2 * cos_w0, 1 - alpha);
+    }
+
+    BiquadCoefficients BiquadCoefficients::peak(double frequency, double gain, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double alpha = std::sin(w0) / (2 * q);
+        double A = std::pow(10, gain / 40);
+        return normalize(1 + alpha * A, -2 * cos_w0, 1 - alpha * A, 1 + alpha / A, -2 * cos_w0, 1 - alpha / A);
+    }
+
+    BiquadCoefficients BiquadCoefficients::lowshelf(double frequency, double gain, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double A = std::pow(10, gain / 40);
+        double beta = std::sqrt(A) * std::sin(w0) / q;
+        return normalize(A * ((A + 1) - (A - 1) * cos_w0 + beta),
+                         2 * A * ((A - 1) - (A + 1) * cos_w0),
+                         A * ((A + 1) - (A - 1) * cos_w0 - beta),
+                         (A + 1) + (A - 1) * cos_w0 + beta,
+                         -2 * ((A - 1) + (A + 1) * cos_w0),
+                         (A + 1) + (A - 1) * cos_w0 - beta);
+    }
+
+    BiquadCoefficients BiquadCoefficients::highshelf(double frequency, double gain, double q, double sample_rate) {
+        double w0 = 2 * M_PI * frequency / sample_rate;
+        double cos_w0 = std::cos(w0);
+        double A = std::pow(10, gain / 40);
+        double beta = std::sqrt(A) * std::sin(w0) / q;
+        return normalize(A * ((A + 1) + (A - 1) * cos_w0 + beta),
+                         -2 * A * ((A - 1) + (A + 1) * cos_w0),
+                         A * ((A + 1) + (A - 1) * cos_w0 - beta),
+                         (A + 1) - (A - 1) * cos_w0 + beta,
+                         2 * ((A - 1) - (A + 1) * cos_w0),
+                         (A + 1) - (A - 1) * cos_w0 - beta);
+    }
+
+    BiquadBank::BiquadBank(unsigned channels, unsigned sections) :
+        _channels(channels), _sections(sections), _interpolate(false), _started(false) {
+        DYN_ASSERT(channels > 0 && sections > 0);
+        constexpr unsigned lanes = Vectorize::BIQUAD_LANES;
+        _groups = (channels + lanes - 1) / lanes;
+
+        // Unused lanes of the last group are pass-through sections, so they never keep any state
+        _coefficients.resize(_groups * _sections * SECTION_COEFFICIENTS * lanes, 0);
+        for (unsigned i = 0; i < _groups * _sections; i++) {
+            std::fill_n(_coefficients.begin() + i * SECTION_COEFFICIENTS * lanes, lanes, 1);
+        }
+        _targets = _coefficients;
+        _deltas.resize(_coefficients.size(), 0);
+        _state.resize(_groups * _sections * SECTION_STATE * lanes, 0);
+        _lanes.reserve(MAX_CHUNK_LENGTH * lanes);
+    }
+
+    unsigned BiquadBank::channels() const { return _channels; }
+
+    unsigned BiquadBank::sections() const { return _sections; }
+
+    void BiquadBank::set(unsigned channel, unsigned section, const BiquadCoefficients &coefficients) {
+        DYN_ASSERT(channel < _channels && section < _sections);
+        constexpr unsigned lanes = Vectorize::BIQUAD_LANES;
+        unsigned group = channel / lanes;
+        unsigned lane = channel % lanes;
+
+        float *target = _targets.data() + (group * _sections + section) * SECTION_COEFFICIENTS * lanes + lane;
+        target[0] = coefficients.b0;
+        target[lanes] = coefficients.b1;
+        target[2 * lanes] = coefficients.b2;
+        target[3 * lanes] = coefficients.a1;
+        target[4 * lanes] = coefficients.a2;
+
+        if (_started) {
+            _interpolate = true;
+        } else {
+            _coefficients = _targets;
+        }
+    }
+
+    void BiquadBank::set(unsigned section, const BiquadCoefficients &coefficients) {
+        for (unsigned c = 0; c < _channels; c++) {
+            set(c, section, coefficients);
+        }
+    }
+
+    void BiquadBank::reset() {
+        std::fill(_state.begin(), _state.end(), 0);
+        _coefficients = _targets;
+        _interpolate = false;
+        _started = false;
+    }
+
+    void BiquadBank::process(const Buffer &src, Buffer &dst) {
+        DYN_ASSERT(src.channels() == _channels);
+        constexpr unsigned lanes = Vectorize::BIQUAD_LANES;
+        unsigned frames = src.frames();
+        dst.resize(frames, _channels);
+        if (frames == 0) {
+            return;
+        }
+        _started = true;
+
+        // Spread coefficient changes evenly across the block
+        if (_interpolate) {
+            float scale = 1.0f / frames;
+            for (unsigned i = 0; i < _coefficients.size(); i++) {
+                _deltas[i] = (_targets[i] - _coefficients[i]) * scale;
+            }
+        }
+
+        _lanes.resize(frames * lanes, 0);
+        for (unsigned g = 0; g < _groups; g++) {
+            unsigned channel_begin = g * lanes;
+            unsigned channel_count = std::min(lanes, _channels - channel_begin);
+
+            // Interleave the channels of the group into lanes
+            for (unsigned l = 0; l < channel_count; l++) {
+                const WaveSample *channel = src[channel_begin + l];
+                for (unsigned f = 0; f < frames; f++) {
+                    _lanes[f * lanes + l] = channel[f];
+                }
+            }
+
+            unsigned coefficient_offset = g * _sections * SECTION_COEFFICIENTS * lanes;
+            unsigned state_offset = g * _sections * SECTION_STATE * lanes;
+            Vectorize::vbiquad(_lanes.data(),
+                               _lanes.data(),
+                               frames,
+                               _coefficients.data() + coefficient_offset,
+                               _interpolate ? _deltas.data() + coefficient_offset : nullptr,
+                               _state.data() + state_offset,
+                               _sections);
+
+            for (unsigned l = 0; l < channel_count; l++) {
+                WaveSample *channel = dst[channel_begin + l];
+                for (unsigned f = 0; f < frames; f++) {
+                    channel[f] = _lanes[f * lanes + l];
+                }
+            }
+        }
+
+        // Land exactly on the targets, accumulating the increments drifts
+        if (_interpolate) {
+            _coefficients = _targets;
+            _interpolate = false;
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
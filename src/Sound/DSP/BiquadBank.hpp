@@ -0,0 +1,192 @@
+#pragma once
+#define _USE_MATH_DEFINES
+
+#include <cmath>
+#include <vector>
+
+#include <Math/Vectorize.hpp>
+
+#include <Sound/Buffer.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Coefficients of a second-order IIR section, normalized so that a0 = 1.
+     *
+     * The designs follow the Audio EQ Cookbook by Robert Bristow-Johnson.
+     *
+     */
+    struct BiquadCoefficients {
+        float b0 = 1;
+        float b1 = 0;
+        float b2 = 0;
+        float a1 = 0;
+        float a2 = 0;
+
+        /**
+         * @brief Attenuate frequencies above the cutoff.
+         *
+         * @param frequency   Cutoff frequency in Hz
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients lowpass(double frequency,
+                                          double q = M_SQRT1_2,
+                                          double sample_rate = STANDARD_SAMPLE_RATE);
+
+        /**
+         * @brief Attenuate frequencies below the cutoff.
+         *
+         * @param frequency   Cutoff frequency in Hz
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients highpass(double frequency,
+                                           double q = M_SQRT1_2,
+                                           double sample_rate = STANDARD_SAMPLE_RATE);
+
+        /**
+         * @brief Pass a band around the center frequency with unit peak gain.
+         *
+         * @param frequency   Center frequency in Hz
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients bandpass(double frequency,
+                                           double q = M_SQRT1_2,
+                                           double sample_rate = STANDARD_SAMPLE_RATE);
+
+        /**
+         * @brief Boost or cut a band around the center frequency.
+         *
+         * @param frequency   Center frequency in Hz
+         * @param gain        Gain at the center frequency in decibels
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients peak(double frequency,
+                                       double gain,
+                                       double q = M_SQRT1_2,
+                                       double sample_rate = STANDARD_SAMPLE_RATE);
+
+        /**
+         * @brief Boost or cut frequencies below the corner frequency.
+         *
+         * @param frequency   Corner frequency in Hz
+         * @param gain        Gain of the shelf in decibels
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients lowshelf(double frequency,
+                                           double gain,
+                                           double q = M_SQRT1_2,
+                                           double sample_rate = STANDARD_SAMPLE_RATE);
+
+        /**
+         * @brief Boost or cut frequencies above the corner frequency.
+         *
+         * @param frequency   Corner frequency in Hz
+         * @param gain        Gain of the shelf in decibels
+         * @param q           Quality factor
+         * @param sample_rate
+         * @return BiquadCoefficients
+         */
+        static BiquadCoefficients highshelf(double frequency,
+                                            double gain,
+                                            double q = M_SQRT1_2,
+                                            double sample_rate = STANDARD_SAMPLE_RATE);
+    };
+
+    /**
+     * @brief Cascade of biquad sections applied to many channels at once.
+     *
+     * Channels are packed into groups of Vectorize::BIQUAD_LANES, with the
+     * coefficients and state of each section stored as one vector per group,
+     * so a single SIMD instruction advances a section on every channel of the
+     * group. Each channel has its own coefficients.
+     *
+     * Changed coefficients are interpolated linearly over the next processed
+     * block to avoid zipper noise.
+     *
+     */
+    class BiquadBank {
+        unsigned _channels;
+        unsigned _sections;
+        unsigned _groups;
+
+        /**
+         * @brief Current, target, and per-frame increments of the
+         * coefficients, indexed by group then section
+         *
+         */
+        std::vector<float> _coefficients;
+        std::vector<float> _targets;
+        std::vector<float> _deltas;
+        bool _interpolate;
+        bool _started;
+
+        std::vector<float> _state;
+        std::vector<float> _lanes;
+
+      public:
+        /**
+         * @brief Construct a new BiquadBank object with pass-through sections.
+         *
+         * @param channels Number of channels
+         * @param sections Number of cascaded sections per channel
+         */
+        BiquadBank(unsigned channels = 1, unsigned sections = 1);
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the number of cascaded sections per channel.
+         *
+         * @return unsigned
+         */
+        unsigned sections() const;
+
+        /**
+         * @brief Set the coefficients of a section of one channel.
+         *
+         * Before the first block is processed the coefficients are set
+         * immediately, otherwise they are interpolated over the next block.
+         *
+         * @param channel
+         * @param section
+         * @param coefficients
+         */
+        void set(unsigned channel, unsigned section, const BiquadCoefficients &coefficients);
+
+        /**
+         * @brief Set the coefficients of a section of all channels.
+         *
+         * @param section
+         * @param coefficients
+         */
+        void set(unsigned section, const BiquadCoefficients &coefficients);
+
+        /**
+         * @brief Clear the filter state and jump to the target coefficients.
+         *
+         */
+        void reset();
+
+        /**
+         * @brief Filter all channels of a signal.
+         *
+         * @param src Source buffer with the bank's number of channels
+         * @param dst Destination buffer, may be equal to src
+         */
+        void process(const Buffer &src, Buffer &dst);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
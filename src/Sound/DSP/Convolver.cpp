@@ -1,62 +1,147 @@
-#include <Math/Fourier.hpp>
+#include <Math/FFTPlan.hpp>
+#include <Math/Vectorize.hpp>
 #include <Sound/DSP/Convolver.hpp>
 
 namespace Dynamo::Sound {
-    void Convolver::initialize(WaveSample *ir, unsigned M) {
-        // Initialize the partition buffer
-        _partition_count = std::ceil(static_cast<float>(M) / BLOCK_LENGTH);
-        _partitions.resize(_partition_count * BLOCK_LENGTH_2);
-        std::fill(_partitions.begin(), _partitions.end(), 0);
+    /**
+     * @brief Get the transform plan of a partition, shared by every convolver
+     *
+     * @return const FFTPlan&
+     */
+    static const FFTPlan &partition_plan() {
+        static const FFTPlan plan(BLOCK_LENGTH_2);
+        return plan;
+    }
 
-        // Copy impulse response and pre-compute the FFT of each partition
-        for (unsigned i = 0; i < _partition_count; i++) {
+    /**
+     * @brief Transform each partition of an impulse response channel
+     *
+     * @param response Destination response
+     * @param channel  Channel index
+     * @param ir       Impulse response buffer
+     * @param M        Length of the impulse response
+     */
+    static void transform_partitions(ImpulseResponse &response, unsigned channel, const WaveSample *ir, unsigned M) {
+        std::array<WaveSample, BLOCK_LENGTH_2> block;
+        for (unsigned i = 0; i < response.partition_count; i++) {
             unsigned ir_offset = i * BLOCK_LENGTH;
-            unsigned partition_offset = i * BLOCK_LENGTH_2;
+            unsigned copy_size = std::min(BLOCK_LENGTH, M - ir_offset);
 
-            unsigned copy_size = std::min(BLOCK_LENGTH, M);
-            std::copy(ir + ir_offset, ir + ir_offset + copy_size, _partitions.data() + partition_offset);
-            Fourier::transform(_partitions.data() + partition_offset, BLOCK_LENGTH_2);
+            // Zero-pad the partition to the transform length
+            std::copy(ir + ir_offset, ir + ir_offset + copy_size, block.begin());
+            std::fill(block.begin() + copy_size, block.end(), 0);
 
-            M -= copy_size;
+            unsigned offset = response.offset(channel, i);
+            partition_plan().forward_real(block.data(), response.re.data() + offset, response.im.data() + offset);
         }
+    }
 
-        // Resize the frequency delay-line, do not zero out
-        _fdl.resize(_partition_count * BLOCK_LENGTH_2);
+    ImpulseResponse::ImpulseResponse(const WaveSample *ir, unsigned M) :
+        partition_count(std::ceil(static_cast<float>(M) / BLOCK_LENGTH)), channels(1) {
+        re.resize(partition_count * SPECTRUM_LENGTH);
+        im.resize(partition_count * SPECTRUM_LENGTH);
+        transform_partitions(*this, 0, ir, M);
     }
 
-    void Convolver::compute(WaveSample *src, WaveSample *dst, unsigned N) {
-        // Shift back the second half of the input buffer
-        std::copy(_input.begin() + BLOCK_LENGTH, _input.begin() + BLOCK_LENGTH_2, _input.begin());
+    ImpulseResponse::ImpulseResponse(const WaveSample *ir_left, const WaveSample *ir_right, unsigned M) :
+        partition_count(std::ceil(static_cast<float>(M) / BLOCK_LENGTH)), channels(2) {
+        re.resize(2 * partition_count * SPECTRUM_LENGTH);
+        im.resize(2 * partition_count * SPECTRUM_LENGTH);
+        transform_partitions(*this, 0, ir_left, M);
+        transform_partitions(*this, 1, ir_right, M);
+    }
 
-        // Read the latest samples, zeroing out the remainder of buffer
-        std::copy(src, src + N, _input.begin() + BLOCK_LENGTH);
-        std::fill(_input.begin() + BLOCK_LENGTH + N, _input.begin() + BLOCK_LENGTH_2, 0);
+    void Convolver::initialize(WaveSample *ir, unsigned M) {
+        set_response(std::make_shared<const ImpulseResponse>(ir, M), false);
+    }
+
+    void Convolver::set_response(std::shared_ptr<const ImpulseResponse> response, bool crossfade) {
+        _previous = crossfade ? _response : nullptr;
+        _response = std::move(response);
 
-        // Shift up the frequency delay-line by one partition
-        std::copy(_fdl.begin(), _fdl.end() - BLOCK_LENGTH_2, _fdl.begin() + BLOCK_LENGTH_2);
+        // The frequency delay-line must hold the longest response
+        unsigned length = _response->partition_count;
+        if (_previous) {
+            length = std::max(length, _previous->partition_count);
+        }
+        if (length != _fdl_length) {
+            resize_fdl(length);
+        }
+    }
 
-        // Forward transform the input block onto the frequency delay-line
-        std::copy(_input.begin(), _input.end(), _fdl.begin());
-        Fourier::transform(_fdl.data(), BLOCK_LENGTH_2);
+    void Convolver::resize_fdl(unsigned length) {
+        // Rotate the latest input block to the front so the history is truncated or extended at the end
+        unsigned head_offset = _fdl_head * SPECTRUM_LENGTH;
+        std::rotate(_fdl_re.begin(), _fdl_re.begin() + head_offset, _fdl_re.end());
+        std::rotate(_fdl_im.begin(), _fdl_im.begin() + head_offset, _fdl_im.end());
+        _fdl_re.resize(length * SPECTRUM_LENGTH, 0);
+        _fdl_im.resize(length * SPECTRUM_LENGTH, 0);
+        _fdl_length = length;
+        _fdl_head = 0;
+    }
 
-        // Convolve with each partition
-        std::fill(_output.begin(), _output.end(), 0);
-        for (unsigned i = 0; i < _partition_count; i++) {
-            unsigned offset = BLOCK_LENGTH_2 * i;
+    void Convolver::convolve(const ImpulseResponse &response,
+                             unsigned channel,
+                             std::array<WaveSample, BLOCK_LENGTH_2> &output) {
+        _accumulator_re.fill(0);
+        _accumulator_im.fill(0);
 
-            // Pointwise multiply and accumulate onto the output buffer
-            for (unsigned j = 0; j < BLOCK_LENGTH_2; j++) {
-                unsigned j_offset = offset + j;
-                _output[j] += _fdl[j_offset] * _partitions[j_offset];
+        // Multiply and accumulate each partition with its input block, walking the delay-line from the latest block
+        unsigned slot = _fdl_head;
+        for (unsigned i = 0; i < response.partition_count; i++) {
+            unsigned fdl_offset = slot * SPECTRUM_LENGTH;
+            unsigned ir_offset = response.offset(channel, i);
+            Vectorize::vcma(_fdl_re.data() + fdl_offset,
+                            _fdl_im.data() + fdl_offset,
+                            response.re.data() + ir_offset,
+                            response.im.data() + ir_offset,
+                            _accumulator_re.data(),
+                            _accumulator_im.data(),
+                            SPECTRUM_LENGTH);
+            if (++slot == _fdl_length) {
+                slot = 0;
             }
         }
 
-        // Inverse transform the output buffer
-        Fourier::inverse(_output.begin(), _output.size());
+        // Inverse transform the accumulated spectrum, which is refilled on the next call
+        partition_plan().inverse_real(_accumulator_re.data(), _accumulator_im.data(), output.data());
+    }
+
+    void Convolver::write_channel(unsigned channel, WaveSample *dst, unsigned N) {
+        convolve(*_response, std::min(channel, _response->channels - 1), _output);
+
+        // Linearly crossfade from the previous response, which shares the same input history
+        if (_previous) {
+            convolve(*_previous, std::min(channel, _previous->channels - 1), _fade_output);
+            for (unsigned i = 0; i < N; i++) {
+                float t = static_cast<float>(i + 1) / N;
+                dst[i] = _fade_output[i + BLOCK_LENGTH] * (1 - t) + _output[i + BLOCK_LENGTH] * t;
+            }
+        } else {
+            std::copy(_output.begin() + BLOCK_LENGTH, _output.begin() + BLOCK_LENGTH + N, dst);
+        }
+    }
+
+    void Convolver::compute(WaveSample *src, WaveSample *dst, unsigned N) { compute(src, dst, nullptr, N); }
+
+    void Convolver::compute(WaveSample *src, WaveSample *dst_left, WaveSample *dst_right, unsigned N) {
+        // Shift back the second half of the input buffer
+        std::copy(_input.begin() + BLOCK_LENGTH, _input.begin() + BLOCK_LENGTH_2, _input.begin());
+
+        // Read the latest samples, zeroing out the remainder of buffer
+        std::copy(src, src + N, _input.begin() + BLOCK_LENGTH);
+        std::fill(_input.begin() + BLOCK_LENGTH + N, _input.begin() + BLOCK_LENGTH_2, 0);
+
+        // Forward transform the input block, overwriting the oldest block of the frequency delay-line
+        _fdl_head = _fdl_head == 0 ? _fdl_length - 1 : _fdl_head - 1;
+        unsigned head_offset = _fdl_head * SPECTRUM_LENGTH;
+        partition_plan().forward_real(_input.data(), _fdl_re.data() + head_offset, _fdl_im.data() + head_offset);
 
-        // Write the second half of the output buffer
-        for (unsigned i = 0; i < N; i++) {
-            dst[i] = _output[i + BLOCK_LENGTH].re;
+        // Convolve each channel with the impulse response
+        write_channel(0, dst_left, N);
+        if (dst_right) {
+            write_channel(1, dst_right, N);
         }
+        _previous = nullptr;
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
-#include <Math/Complex.hpp>
 #include <Utils/Bits.hpp>
 
 #include <Sound/Buffer.hpp>
@@ -23,11 +23,84 @@ namespace Dynamo::Sound {
      */
     static constexpr unsigned BLOCK_LENGTH_2 = BLOCK_LENGTH << 1;
 
+    /**
+     * @brief Number of frequency bins in the real transform of a partition
+     *
+     */
+    static constexpr unsigned SPECTRUM_LENGTH = BLOCK_LENGTH + 1;
+
+    /**
+     * @brief Partitioned frequency-domain impulse response
+     *
+     * The spectrum of each partition is stored as separate arrays of real
+     * and imaginary parts for vectorized multiply-accumulation. A response
+     * may have two channels, e.g., for the left and right ears, that are
+     * convolved with the same input.
+     *
+     * Responses are immutable, so they can be shared between convolvers.
+     *
+     */
+    struct ImpulseResponse {
+        /**
+         * @brief Real parts of the spectra, indexed by channel then partition
+         *
+         */
+        std::vector<float> re;
+
+        /**
+         * @brief Imaginary parts of the spectra, indexed by channel then partition
+         *
+         */
+        std::vector<float> im;
+
+        /**
+         * @brief Number of partitions
+         *
+         */
+        unsigned partition_count;
+
+        /**
+         * @brief Number of channels
+         *
+         */
+        unsigned channels;
+
+        /**
+         * @brief Transform an impulse response
+         *
+         * @param ir Impulse response buffer
+         * @param M  Length of the impulse response
+         */
+        ImpulseResponse(const WaveSample *ir, unsigned M);
+
+        /**
+         * @brief Transform a pair of impulse responses
+         *
+         * @param ir_left  Impulse response of the first channel
+         * @param ir_right Impulse response of the second channel
+         * @param M        Length of the impulse responses
+         */
+        ImpulseResponse(const WaveSample *ir_left, const WaveSample *ir_right, unsigned M);
+
+        /**
+         * @brief Get the offset of a partition spectrum
+         *
+         * @param channel
+         * @param partition
+         * @return unsigned
+         */
+        inline unsigned offset(unsigned channel, unsigned partition) const {
+            return (channel * partition_count + partition) * SPECTRUM_LENGTH;
+        }
+    };
+
     /**
      * @brief Signal convolution engine
      *
-     * This implements the overlap-save block algorithm to compute convolutions
-     * in real-time
+     * This implements the uniformly-partitioned overlap-save algorithm to
+     * compute convolutions in real-time. Input blocks are transformed once
+     * with a real FFT onto a circular frequency delay line, which is then
+     * multiply-accumulated against each partition of the impulse response.
      *
      */
     class Convolver {
@@ -41,25 +114,90 @@ namespace Dynamo::Sound {
          * @brief Output sample buffer
          *
          */
-        std::array<Complex, BLOCK_LENGTH_2> _output = {0};
+        std::array<WaveSample, BLOCK_LENGTH_2> _output = {0};
 
         /**
-         * @brief Frequency delay line
+         * @brief Output sample buffer of the previous impulse response
          *
          */
-        std::vector<Complex> _fdl;
+        std::array<WaveSample, BLOCK_LENGTH_2> _fade_output = {0};
 
         /**
-         * @brief Partitioned FFT transforms of the impulse response
+         * @brief Accumulated spectrum, real part
          *
          */
-        std::vector<Complex> _partitions;
+        std::array<float, SPECTRUM_LENGTH> _accumulator_re;
 
         /**
-         * @brief Number of partitions
+         * @brief Accumulated spectrum, imaginary part
+         *
+         */
+        std::array<float, SPECTRUM_LENGTH> _accumulator_im;
+
+        /**
+         * @brief Circular frequency delay line, real part
+         *
+         */
+        std::vector<float> _fdl_re;
+
+        /**
+         * @brief Circular frequency delay line, imaginary part
+         *
+         */
+        std::vector<float> _fdl_im;
+
+        /**
+         * @brief Number of partitions in the frequency delay line
          *
          */
-        unsigned _partition_count;
+        unsigned _fdl_length = 0;
+
+        /**
+         * @brief Partition of the frequency delay line holding the latest input block
+         *
+         */
+        unsigned _fdl_head = 0;
+
+        /**
+         * @brief Impulse response
+         *
+         */
+        std::shared_ptr<const ImpulseResponse> _response;
+
+        /**
+         * @brief Impulse response to crossfade from on the next chunk
+         *
+         */
+        std::shared_ptr<const ImpulseResponse> _previous;
+
+        /**
+         * @brief Resize the frequency delay line, preserving the most recent input blocks
+         *
+         * @param length Number of partitions
+         */
+        void resize_fdl(unsigned length);
+
+        /**
+         * @brief Multiply the delay line with a channel of an impulse response
+         * and transform the result back to the time-domain
+         *
+         * @param response
+         * @param channel
+         * @param output
+         */
+        void convolve(const ImpulseResponse &response,
+                      unsigned channel,
+                      std::array<WaveSample, BLOCK_LENGTH_2> &output);
+
+        /**
+         * @brief Convolve a channel and write it to the destination, crossfading
+         * from the previous response if necessary
+         *
+         * @param channel
+         * @param dst
+         * @param N
+         */
+        void write_channel(unsigned channel, WaveSample *dst, unsigned N);
 
       public:
         /**
@@ -70,6 +208,14 @@ namespace Dynamo::Sound {
          */
         void initialize(WaveSample *ir, unsigned M);
 
+        /**
+         * @brief Set a precomputed impulse response to convolve
+         *
+         * @param response  Impulse response
+         * @param crossfade Crossfade from the current response over the next chunk
+         */
+        void set_response(std::shared_ptr<const ImpulseResponse> response, bool crossfade);
+
         /**
          * @brief Apply the impulse repsonse to a sound chunk
          *
@@ -78,5 +224,16 @@ namespace Dynamo::Sound {
          * @param N   Length of the sound, must be <= MAX_CHUNK_LENGTH
          */
         void compute(WaveSample *src, WaveSample *dst, unsigned N);
+
+        /**
+         * @brief Apply a two-channel impulse response to a sound chunk. A single
+         * channel response is written to both destinations.
+         *
+         * @param src       Source sound buffer
+         * @param dst_left  Destination sound buffer of the first channel
+         * @param dst_right Destination sound buffer of the second channel
+         * @param N         Length of the sound, must be <= MAX_CHUNK_LENGTH
+         */
+        void compute(WaveSample *src, WaveSample *dst_left, WaveSample *dst_right, unsigned N);
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include <algorithm>
+
+#include <Sound/DSP/HRIRCache.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of quantized azimuths, spanning [-90, 90] degrees
+     *
+     */
+    static constexpr unsigned AZIMUTH_STEPS = 180 / HRIR_CACHE_RESOLUTION + 1;
+
+    /**
+     * @brief Number of quantized elevations, spanning [-90, 270] degrees
+     *
+     */
+    static constexpr unsigned ELEVATION_STEPS = 360 / HRIR_CACHE_RESOLUTION + 1;
+
+    /**
+     * @brief Quantize an angle to the nearest step, mapping NaN to the first step
+     *
+     * @param angle
+     * @param lo    Angle of the first step
+     * @param steps Number of steps
+     * @return unsigned
+     */
+    static unsigned quantize(float angle, float lo, unsigned steps) {
+        float step = std::round((angle - lo) / HRIR_CACHE_RESOLUTION);
+        return step > 0 ? std::min(step, steps - 1.0f) : 0;
+    }
+
+    HRIRCache::HRIRCache(unsigned capacity) : _capacity(capacity), _clock(0) {
+        _hrir.resize(HRIR_LENGTH, 2);
+        _entries.reserve(capacity);
+    }
+
+    HRIRCache &HRIRCache::shared() {
+        static HRIRCache cache;
+        return cache;
+    }
+
+    unsigned HRIRCache::direction(const Vec3 &listener_position,
+                                  const Quaternion &listener_rotation,
+                                  const Vec3 &source_position) const {
+        Vec2 point = _hrtf.compute_point(listener_position, source_position);
+        unsigned azimuth = quantize(point.x, -90, AZIMUTH_STEPS);
+        unsigned elevation = quantize(point.y, -90, ELEVATION_STEPS);
+        return elevation * AZIMUTH_STEPS + azimuth;
+    }
+
+    std::shared_ptr<const ImpulseResponse> HRIRCache::get(unsigned direction) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _clock++;
+
+        // Free the evicted responses that are no longer used by any filter
+        auto r_it = std::remove_if(_retired.begin(), _retired.end(), [](const auto &response) {
+            return response.use_count() == 1;
+        });
+        _retired.erase(r_it, _retired.end());
+
+        auto slot_it = _slots.find(direction);
+        if (slot_it != _slots.end()) {
+            Entry &entry = _entries[slot_it->second];
+            entry.last_used = _clock;
+            return entry.response;
+        }
+
+        // Compute the HRIR at the center of the quantized direction
+        Vec2 point(-90 + (direction % AZIMUTH_STEPS) * HRIR_CACHE_RESOLUTION,
+                   -90 + (direction / AZIMUTH_STEPS) * HRIR_CACHE_RESOLUTION);
+        _hrtf.calculate_HRIR(point, _hrir);
+        auto response = std::make_shared<const ImpulseResponse>(_hrir[0], _hrir[1], HRIR_LENGTH);
+
+        // Evict the least recently used direction if full
+        unsigned slot = _entries.size();
+        if (slot < _capacity) {
+            _entries.push_back({direction, _clock, response});
+        } else {
+            slot = 0;
+            for (unsigned i = 1; i < _entries.size(); i++) {
+                if (_entries[i].last_used < _entries[slot].last_used) {
+                    slot = i;
+                }
+            }
+            _slots.erase(_entries[slot].direction);
+            _retired.push_back(std::move(_entries[slot].response));
+            _entries[slot] = {direction, _clock, response};
+        }
+        _slots.emplace(direction, slot);
+        return response;
+    }
+
+    std::shared_ptr<const ImpulseResponse> HRIRCache::find(unsigned direction) {
+        std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return nullptr;
+        }
+        _clock++;
+
+        auto slot_it = _slots.find(direction);
+        if (slot_it == _slots.end()) {
+            return nullptr;
+        }
+        Entry &entry = _entries[slot_it->second];
+        entry.last_used = _clock;
+        return entry.response;
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Math/Quaternion.hpp>
+#include <Math/Vec3.hpp>
+#include <Utils/FlatMap.hpp>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/Convolver.hpp>
+#include <Sound/DSP/HRTF.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Angular resolution in degrees at which directions are cached
+     *
+     */
+    static constexpr float HRIR_CACHE_RESOLUTION = 2;
+
+    /**
+     * @brief Default maximum number of cached directions
+     *
+     */
+    static constexpr unsigned HRIR_CACHE_CAPACITY = 256;
+
+    /**
+     * @brief Least-recently-used cache of frequency-domain HRIRs, shared
+     * between sources.
+     *
+     * Directions are quantized to a grid over azimuth and elevation, and
+     * each cached response holds the left and right ears as two channels
+     * convolved against the same input.
+     *
+     * Lookups are thread-safe. Responses are computed by get() off the audio
+     * thread, while find() can be called from the output callback. Evicted
+     * responses are held until no filter uses them, so the audio thread
+     * never frees one.
+     *
+     */
+    class HRIRCache {
+        struct Entry {
+            unsigned direction;
+            uint64_t last_used;
+            std::shared_ptr<const ImpulseResponse> response;
+        };
+
+        HRTF _hrtf;
+        Buffer _hrir;
+
+        std::vector<Entry> _entries;
+        std::vector<std::shared_ptr<const ImpulseResponse>> _retired;
+        FlatMap<unsigned, unsigned> _slots;
+        unsigned _capacity;
+        uint64_t _clock;
+
+        std::mutex _mutex;
+
+      public:
+        /**
+         * @brief Construct a new HRIRCache object.
+         *
+         * @param capacity Maximum number of cached directions
+         */
+        HRIRCache(unsigned capacity = HRIR_CACHE_CAPACITY);
+
+        /**
+         * @brief Get the cache shared by default between all binaural filters.
+         *
+         * @return HRIRCache&
+         */
+        static HRIRCache &shared();
+
+        /**
+         * @brief Quantize the direction of a sound source relative to the listener.
+         *
+         * Directions outside of the HRTF point space are clamped to its edges.
+         *
+         * @param listener_position Position of the listener
+         * @param listener_rotation Rotation of the listener
+         * @param source_position   Position of the sound source
+         * @return unsigned
+         */
+        unsigned direction(const Vec3 &listener_position,
+                           const Quaternion &listener_rotation,
+                           const Vec3 &source_position) const;
+
+        /**
+         * @brief Get the stereo impulse response of a quantized direction,
+         * computing it if it is not cached.
+         *
+         * @param direction
+         * @return std::shared_ptr<const ImpulseResponse>
+         */
+        std::shared_ptr<const ImpulseResponse> get(unsigned direction);
+
+        /**
+         * @brief Get the stereo impulse response of a quantized direction if
+         * it is cached.
+         *
+         * This never blocks, computes, or allocates, so it is safe to call
+         * from the output callback. It also returns nullptr if another thread
+         * is using the cache.
+         *
+         * @param direction
+         * @return std::shared_ptr<const ImpulseResponse>
+         */
+        std::shared_ptr<const ImpulseResponse> find(unsigned direction);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
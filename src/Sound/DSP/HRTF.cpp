@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <limits>
 #include <unordered_map>
 
 #include <Math/Common.hpp>
@@ -26,13 +28,13 @@ namespace Dynamo::Sound {
         }
 
         // Triangulate points
-        // TODO: Register triangles into a quadtree for faster querying
         std::vector<Vec2> tmp_points = _points;
         for (const Triangle2 &triangle : Delaunay::triangulate(tmp_points)) {
             _indices.push_back(index_map[triangle.a]);
             _indices.push_back(index_map[triangle.b]);
             _indices.push_back(index_map[triangle.c]);
         }
+        build_grid();
 
         // Read the HRIR samples for each point
         unsigned offset = 0;
@@ -47,6 +49,68 @@ namespace Dynamo::Sound {
         }
     }
 
+    void HRTF::build_grid() {
+        // Bound the point space
+        Vec2 lo = _points[0];
+        Vec2 hi = _points[0];
+        for (const Vec2 &point : _points) {
+            lo.x = std::min(lo.x, point.x);
+            lo.y = std::min(lo.y, point.y);
+            hi.x = std::max(hi.x, point.x);
+            hi.y = std::max(hi.y, point.y);
+        }
+        _grid_origin = lo;
+        _grid_cell_size = (hi - lo) / HRTF_GRID_SIZE;
+
+        // Register each triangle in every cell overlapped by its bounding box,
+        // counting first so the cell lists can be packed contiguously
+        _grid_offsets.assign(HRTF_GRID_SIZE * HRTF_GRID_SIZE + 1, 0);
+        for (unsigned pass = 0; pass < 2; pass++) {
+            for (unsigned t = 0; t < _indices.size(); t += 3) {
+                const Vec2 &a = _points[_indices[t]];
+                const Vec2 &b = _points[_indices[t + 1]];
+                const Vec2 &c = _points[_indices[t + 2]];
+
+                unsigned x0, y0, x1, y1;
+                grid_coords(Vec2(std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y})), x0, y0);
+                grid_coords(Vec2(std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y})), x1, y1);
+                for (unsigned y = y0; y <= y1; y++) {
+                    for (unsigned x = x0; x <= x1; x++) {
+                        unsigned cell = y * HRTF_GRID_SIZE + x;
+                        if (pass == 0) {
+                            _grid_offsets[cell + 1]++;
+                        } else {
+                            _grid_triangles[_grid_offsets[cell]++] = t;
+                        }
+                    }
+                }
+            }
+
+            if (pass == 0) {
+                // Prefix sum the counts into the start of each cell
+                for (unsigned i = 1; i < _grid_offsets.size(); i++) {
+                    _grid_offsets[i] += _grid_offsets[i - 1];
+                }
+                _grid_triangles.resize(_grid_offsets.back());
+            } else {
+                // Filling advanced each start to the end of its cell, shift them back
+                for (unsigned i = _grid_offsets.size() - 1; i > 0; i--) {
+                    _grid_offsets[i] = _grid_offsets[i - 1];
+                }
+                _grid_offsets[0] = 0;
+            }
+        }
+    }
+
+    void HRTF::grid_coords(const Vec2 &point, unsigned &x, unsigned &y) const {
+        // Points outside of the grid (or NaN) are mapped to the nearest edge cell
+        Vec2 cell = point - _grid_origin;
+        cell.x /= _grid_cell_size.x;
+        cell.y /= _grid_cell_size.y;
+        x = cell.x > 0 ? std::min(cell.x, HRTF_GRID_SIZE - 1.0f) : 0;
+        y = cell.y > 0 ? std::min(cell.y, HRTF_GRID_SIZE - 1.0f) : 0;
+    }
+
     Vec2 HRTF::compute_point(const Vec3 &listener_position, const Vec3 &source_position) const {
         Vec3 disp = source_position - listener_position;
 
@@ -63,32 +127,48 @@ namespace Dynamo::Sound {
                               const Quaternion &listener_rotation,
                               const Vec3 &source_position,
                               Buffer &dst) const {
+        calculate_HRIR(compute_point(listener_position, source_position), dst);
+    }
+
+    void HRTF::calculate_HRIR(const Vec2 &point, Buffer &dst) const {
         dst.silence();
-        Vec2 point = compute_point(listener_position, source_position);
-        for (unsigned t = 0; t < _indices.size(); t += 3) {
-            unsigned a = _indices[t];
-            unsigned b = _indices[t + 1];
-            unsigned c = _indices[t + 2];
 
-            Triangle2 triangle(_points[a], _points[b], _points[c]);
+        // Only test the triangles that overlap the cell of the point. The point may sit on an edge shared by two
+        // triangles and be rounded just outside of both, so the triangle it is deepest inside is used.
+        unsigned x, y;
+        grid_coords(point, x, y);
+        unsigned cell = y * HRTF_GRID_SIZE + x;
+        unsigned best = _indices.size();
+        float best_depth = -std::numeric_limits<float>::infinity();
+        Vec3 best_coords;
+        for (unsigned i = _grid_offsets[cell]; i < _grid_offsets[cell + 1]; i++) {
+            unsigned t = _grid_triangles[i];
+            Triangle2 triangle(_points[_indices[t]], _points[_indices[t + 1]], _points[_indices[t + 2]]);
             Vec3 coords = triangle.barycentric(point);
+            float depth = std::min({coords.x, coords.y, coords.z});
+            if (depth > best_depth) {
+                best = t;
+                best_depth = depth;
+                best_coords = coords;
+                if (depth >= 0) break;
+            }
+        }
 
-            float eps = 1e-6;
-            if (coords.x >= -eps && coords.y >= -eps && coords.z >= -eps) {
-                const Buffer &ir0 = _coeff_map[a];
-                const Buffer &ir1 = _coeff_map[b];
-                const Buffer &ir2 = _coeff_map[c];
-
-                // Use barycentric coordinates to interpolate samples
-                for (unsigned c = 0; c < dst.channels(); c++) {
-                    WaveSample *ptr = dst[c];
-                    unsigned frames = dst.frames();
-                    Vectorize::vsma(ir0[c], coords.x, ptr, frames);
-                    Vectorize::vsma(ir1[c], coords.y, ptr, frames);
-                    Vectorize::vsma(ir2[c], coords.z, ptr, frames);
-                }
-                return;
+        float eps = 1e-3;
+        if (best_depth >= -eps) {
+            const Buffer &ir0 = _coeff_map[_indices[best]];
+            const Buffer &ir1 = _coeff_map[_indices[best + 1]];
+            const Buffer &ir2 = _coeff_map[_indices[best + 2]];
+
+            // Use barycentric coordinates to interpolate samples
+            for (unsigned c = 0; c < dst.channels(); c++) {
+                WaveSample *ptr = dst[c];
+                unsigned frames = dst.frames();
+                Vectorize::vsma(ir0[c], best_coords.x, ptr, frames);
+                Vectorize::vsma(ir1[c], best_coords.y, ptr, frames);
+                Vectorize::vsma(ir2[c], best_coords.z, ptr, frames);
             }
+            return;
         }
         Log::error("HRTF could not triagulate ({} {})", point.x, point.y);
     }
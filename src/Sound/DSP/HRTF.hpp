@@ -42,6 +42,12 @@ namespace Dynamo::Sound {
         5,   10,  15,  20,  25,  30,  35,  40,  45,  55,  65,  80,  90,
     };
 
+    /**
+     * @brief Number of cells along each axis of the triangle lookup grid
+     *
+     */
+    static constexpr unsigned HRTF_GRID_SIZE = 64;
+
     /**
      * @brief Head-related transfer function computes impulse response
      * coefficients at a point
@@ -51,8 +57,36 @@ namespace Dynamo::Sound {
         std::vector<Vec2> _points;
         std::vector<unsigned> _indices;
 
+        // Uniform grid over the point space, listing the triangles that overlap each cell
+        Vec2 _grid_origin;
+        Vec2 _grid_cell_size;
+        std::vector<unsigned> _grid_offsets;
+        std::vector<unsigned> _grid_triangles;
+
         std::vector<Buffer> _coeff_map;
 
+        /**
+         * @brief Build the triangle lookup grid
+         *
+         */
+        void build_grid();
+
+        /**
+         * @brief Compute the grid cell coordinates containing a point
+         *
+         * @param point
+         * @param x     Cell column
+         * @param y     Cell row
+         */
+        void grid_coords(const Vec2 &point, unsigned &x, unsigned &y) const;
+
+      public:
+        /**
+         * @brief Construct a new HRTF object
+         *
+         */
+        HRTF();
+
         /**
          * @brief Compute the azimuth and elevation angles
          *
@@ -62,12 +96,14 @@ namespace Dynamo::Sound {
          */
         Vec2 compute_point(const Vec3 &listener_position, const Vec3 &source_position) const;
 
-      public:
         /**
-         * @brief Construct a new HRTF object
+         * @brief Calculate the head-related impulse response at an azimuth
+         * and elevation, applying interpolation as needed
          *
+         * @param point Azimuth and elevation angles
+         * @param dst   Destination buffer
          */
-        HRTF();
+        void calculate_HRIR(const Vec2 &point, Buffer &dst) const;
 
         /**
          * @brief Calculate the head-related impulse response for a sound source
@@ -0,0 +1,152 @@
+#include <Math/Vectorize.hpp>
+#include <Sound/DSP/NonUniformConvolver.hpp>
+#include <Utils/Log.hpp>
+
+namespace Dynamo::Sound {
+    NonUniformConvolver::Segment::Segment(const Buffer &ir, unsigned offset, unsigned length, unsigned block_length) :
+        block_length(block_length),
+        spectrum_length(block_length + 1),
+        partition_count(std::ceil(static_cast<float>(length) / block_length)),
+        channels(ir.channels()),
+        plan(2 * block_length),
+        task(std::make_shared<DeadlineScheduler::Task>([this]() { process(); })) {
+        unsigned spectra_size = channels * partition_count * spectrum_length;
+        ir_re.resize(spectra_size);
+        ir_im.resize(spectra_size);
+        fdl_re.resize(partition_count * spectrum_length, 0);
+        fdl_im.resize(partition_count * spectrum_length, 0);
+
+        block.resize(block_length, 0);
+        window.resize(2 * block_length, 0);
+        accumulator_re.resize(spectrum_length);
+        accumulator_im.resize(spectrum_length);
+        output.resize(2 * block_length);
+        for (Buffer &buffer : outputs) {
+            buffer.resize(block_length, channels);
+            buffer.silence();
+        }
+
+        // Pre-compute the FFT of each zero-padded partition
+        for (unsigned c = 0; c < channels; c++) {
+            for (unsigned i = 0; i < partition_count; i++) {
+                unsigned ir_offset = offset + i * block_length;
+                unsigned copy_size = std::min(block_length, offset + length - ir_offset);
+                std::copy(ir[c] + ir_offset, ir[c] + ir_offset + copy_size, output.begin());
+                std::fill(output.begin() + copy_size, output.end(), 0);
+
+                unsigned spectrum_offset = (c * partition_count + i) * spectrum_length;
+                plan.forward_real(output.data(), ir_re.data() + spectrum_offset, ir_im.data() + spectrum_offset);
+            }
+        }
+    }
+
+    void NonUniformConvolver::Segment::process() {
+        // Forward transform the window, overwriting the oldest block of the frequency delay-line
+        fdl_head = fdl_head == 0 ? partition_count - 1 : fdl_head - 1;
+        unsigned head_offset = fdl_head * spectrum_length;
+        plan.forward_real(window.data(), fdl_re.data() + head_offset, fdl_im.data() + head_offset);
+
+        Buffer &next = outputs[ready ^ 1];
+        for (unsigned c = 0; c < channels; c++) {
+            std::fill(accumulator_re.begin(), accumulator_re.end(), 0);
+            std::fill(accumulator_im.begin(), accumulator_im.end(), 0);
+
+            // Multiply and accumulate each partition with its input block
+            unsigned slot = fdl_head;
+            for (unsigned i = 0; i < partition_count; i++) {
+                unsigned fdl_offset = slot * spectrum_length;
+                unsigned ir_offset = (c * partition_count + i) * spectrum_length;
+                Vectorize::vcma(fdl_re.data() + fdl_offset,
+                                fdl_im.data() + fdl_offset,
+                                ir_re.data() + ir_offset,
+                                ir_im.data() + ir_offset,
+                                accumulator_re.data(),
+                                accumulator_im.data(),
+                                spectrum_length);
+                if (++slot == partition_count) {
+                    slot = 0;
+                }
+            }
+
+            // Inverse transform and keep the valid second half, the accumulators are refilled for the next channel
+            plan.inverse_real(accumulator_re.data(), accumulator_im.data(), output.data());
+            std::copy(output.begin() + block_length, output.end(), next[c]);
+        }
+    }
+
+    NonUniformConvolver::NonUniformConvolver(const Buffer &ir, double sample_rate, DeadlineScheduler &scheduler) :
+        _channels(ir.channels()), _sample_rate(sample_rate), _scheduler(scheduler) {
+        DYN_ASSERT(_channels == 1 || _channels == 2);
+        DYN_ASSERT(ir.frames() > 0);
+
+        // The head is convolved with the smallest partitions for low latency
+        unsigned length = ir.frames();
+        unsigned head_length = std::min(length, HEAD_LENGTH);
+        if (_channels == 1) {
+            _head.set_response(std::make_shared<const ImpulseResponse>(ir[0], head_length), false);
+        } else {
+            _head.set_response(std::make_shared<const ImpulseResponse>(ir[0], ir[1], head_length), false);
+        }
+
+        // Each tail segment spans [2L, 2L * TAIL_GROWTH), except the last one which spans the rest
+        unsigned block_length = BLOCK_LENGTH * TAIL_GROWTH;
+        unsigned offset = HEAD_LENGTH;
+        while (offset < length) {
+            unsigned end = length;
+            if (block_length < TAIL_MAX_BLOCK_LENGTH) {
+                end = std::min(length, 2 * block_length * TAIL_GROWTH);
+            }
+            _segments.push_back(std::make_unique<Segment>(ir, offset, end - offset, block_length));
+            offset = end;
+            block_length = std::min(block_length * TAIL_GROWTH, TAIL_MAX_BLOCK_LENGTH);
+        }
+    }
+
+    NonUniformConvolver::~NonUniformConvolver() {
+        for (std::unique_ptr<Segment> &segment : _segments) {
+            _scheduler.wait(segment->task);
+        }
+    }
+
+    unsigned NonUniformConvolver::channels() const { return _channels; }
+
+    void NonUniformConvolver::compute(WaveSample *src, Buffer &dst, unsigned N) {
+        DYN_ASSERT(N <= BLOCK_LENGTH);
+        _head.compute(src, dst[0], _channels == 2 ? dst[1] : nullptr, N);
+
+        for (std::unique_ptr<Segment> &segment : _segments) {
+            // Read the latest samples, zeroing out the remainder of the block like the head
+            std::copy(src, src + N, segment->block.begin() + segment->fill);
+            std::fill(segment->block.begin() + segment->fill + N,
+                      segment->block.begin() + segment->fill + BLOCK_LENGTH,
+                      0);
+
+            // Mix in the output computed for this block
+            Buffer &ready = segment->outputs[segment->ready];
+            for (unsigned c = 0; c < _channels; c++) {
+                Vectorize::vadd(dst[c], ready[c] + segment->fill, dst[c], N);
+            }
+
+            segment->fill += BLOCK_LENGTH;
+            if (segment->fill < segment->block_length) {
+                continue;
+            }
+            segment->fill = 0;
+
+            // The previous block must be finished, its output is played back next
+            // Both outputs start silent, so the first swap before any block is submitted is harmless
+            _scheduler.wait(segment->task);
+            segment->ready ^= 1;
+
+            // Slide the overlap-save window and schedule the block, due when the current output runs out
+            unsigned L = segment->block_length;
+            std::copy(segment->window.begin() + L, segment->window.end(), segment->window.begin());
+            std::copy(segment->block.begin(), segment->block.end(), segment->window.begin() + L);
+
+            auto duration = std::chrono::duration<double>(L / _sample_rate);
+            auto deadline = DeadlineScheduler::Clock::now() +
+                            std::chrono::duration_cast<DeadlineScheduler::Clock::duration>(duration);
+            _scheduler.submit(segment->task, deadline);
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <Math/FFTPlan.hpp>
+#include <Utils/DeadlineScheduler.hpp>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/Convolver.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Growth factor of the block length between consecutive tail segments
+     *
+     */
+    static constexpr unsigned TAIL_GROWTH = 4;
+
+    /**
+     * @brief Maximum block length of a tail segment
+     *
+     */
+    static constexpr unsigned TAIL_MAX_BLOCK_LENGTH = BLOCK_LENGTH << 8;
+
+    /**
+     * @brief Length of the head of the impulse response, convolved on the
+     * calling thread
+     *
+     */
+    static constexpr unsigned HEAD_LENGTH = 2 * BLOCK_LENGTH * TAIL_GROWTH;
+
+    /**
+     * @brief Non-uniformly partitioned convolution engine for long impulse
+     * responses.
+     *
+     * The head of the impulse response is convolved with a uniform Convolver
+     * on the calling thread for zero latency. The tail is split into segments
+     * with block lengths growing by TAIL_GROWTH up to TAIL_MAX_BLOCK_LENGTH.
+     * A segment with block length L starts at offset 2L, so it has a full
+     * block of time to convolve each input block on a background thread
+     * before its output is needed.
+     *
+     * Like Convolver, each call to compute advances time by BLOCK_LENGTH
+     * frames.
+     *
+     * Submitting a segment does not lock or allocate. However, if a worker is
+     * still convolving a segment when its output is due, compute spins until
+     * it is done, and a segment that no worker has started is convolved inline.
+     * Either stalls the calling thread for up to the cost of one tail block.
+     *
+     */
+    class NonUniformConvolver {
+        /**
+         * @brief Uniformly partitioned segment of the tail
+         *
+         */
+        struct Segment {
+            unsigned block_length;
+            unsigned spectrum_length;
+            unsigned partition_count;
+            unsigned channels;
+
+            /**
+             * @brief Transform plan of the 2 * block_length overlap-save window
+             *
+             */
+            FFTPlan plan;
+
+            /**
+             * @brief Spectra of the impulse response partitions, indexed by
+             * channel then partition
+             *
+             */
+            std::vector<float> ir_re;
+            std::vector<float> ir_im;
+
+            /**
+             * @brief Circular frequency delay line
+             *
+             */
+            std::vector<float> fdl_re;
+            std::vector<float> fdl_im;
+            unsigned fdl_head = 0;
+
+            /**
+             * @brief Input block being filled by the caller
+             *
+             */
+            std::vector<WaveSample> block;
+            unsigned fill = 0;
+
+            /**
+             * @brief Overlap-save window of the last two input blocks
+             *
+             */
+            std::vector<WaveSample> window;
+
+            /**
+             * @brief Background processing scratch buffers
+             *
+             */
+            std::vector<float> accumulator_re;
+            std::vector<float> accumulator_im;
+            std::vector<WaveSample> output;
+
+            /**
+             * @brief Double-buffered output blocks. One is played back while
+             * the other is computed in the background.
+             *
+             */
+            std::array<Buffer, 2> outputs;
+            unsigned ready = 0;
+
+            /**
+             * @brief Background task, allocated once and resubmitted for each block
+             *
+             */
+            DeadlineScheduler::TaskRef task;
+
+            /**
+             * @brief Construct a new Segment object.
+             *
+             * @param ir           Impulse response
+             * @param offset       Offset of the segment in the impulse response
+             * @param length       Length of the segment
+             * @param block_length Block length
+             */
+            Segment(const Buffer &ir, unsigned offset, unsigned length, unsigned block_length);
+
+            /**
+             * @brief Convolve the current window, writing the result to the next output block.
+             *
+             */
+            void process();
+        };
+
+        Convolver _head;
+        std::vector<std::unique_ptr<Segment>> _segments;
+        unsigned _channels;
+
+        double _sample_rate;
+        DeadlineScheduler &_scheduler;
+
+      public:
+        /**
+         * @brief Construct a new NonUniformConvolver object.
+         *
+         * @param ir          Impulse response with 1 or 2 channels
+         * @param sample_rate Sample rate used to schedule background deadlines
+         * @param scheduler   Scheduler of the tail segments
+         */
+        NonUniformConvolver(const Buffer &ir,
+                            double sample_rate = STANDARD_SAMPLE_RATE,
+                            DeadlineScheduler &scheduler = DeadlineScheduler::shared());
+
+        /**
+         * @brief Destroy the NonUniformConvolver object, waiting for its background tasks.
+         *
+         */
+        ~NonUniformConvolver();
+
+        /**
+         * @brief Get the number of output channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Apply the impulse response to a sound chunk.
+         *
+         * @param src Source sound buffer
+         * @param dst Destination buffer with at least N frames and the channels of the response
+         * @param N   Length of the sound, must be <= MAX_CHUNK_LENGTH
+         */
+        void compute(WaveSample *src, Buffer &dst, unsigned N);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,66 +1,100 @@
+#include <numeric>
+
+#include <Math/Vectorize.hpp>
 #include <Sound/DSP/Resample.hpp>
 
 namespace Dynamo::Sound {
-    void resample_signal(WaveSample *src,
-                         WaveSample *dst,
-                         double time_offset,
-                         double src_length,
-                         double src_rate,
-                         double dst_rate) {
-        double factor = dst_rate / src_rate;
-        double scale = std::min(1.0, factor);
-        double time_increment = 1.0 / factor;
+    Resampler::Resampler(double src_rate, double dst_rate) {
+        // Reduce the ratio of the rates to a fraction
+        unsigned src = std::round(src_rate);
+        unsigned dst = std::round(dst_rate);
+        unsigned divisor = std::gcd(src, dst);
+        _up = dst / divisor;
+        _down = src / divisor;
+        if (_up > RESAMPLER_MAX_PHASES) {
+            _down = std::max(std::round(static_cast<double>(_down) * RESAMPLER_MAX_PHASES / _up), 1.0);
+            _up = RESAMPLER_MAX_PHASES;
+        }
 
-        unsigned dst_length = src_length * factor;
-        unsigned filter_step = scale * FILTER_PRECISION;
+        // Lower the cutoff to the destination Nyquist frequency when downsampling.
+        // The radius is padded so that every phase fills whole SIMD registers.
+        double scale = std::min(1.0, static_cast<double>(_up) / _down);
+        _radius = std::ceil(RESAMPLER_ZERO_CROSSINGS / scale);
+        _radius = (_radius + 3) & ~3U;
+        _taps = 2 * _radius;
 
-        double time = time_offset;
-        double time_end = src_length + time_offset;
+        _bank.resize(_up * _taps);
+        for (unsigned p = 0; p < _up; p++) {
+            float *coeffs = _bank.data() + p * _taps;
 
-        for (unsigned dst_f = 0; dst_f < dst_length; dst_f++) {
-            // Target sample
-            double dst_sample = 0;
+            // Tap k is applied to the source frame k + 1 - radius frames from the floor of the position
+            double sum = 0;
+            for (unsigned k = 0; k < _taps; k++) {
+                double t = (k + 1.0 - _radius) - static_cast<double>(p) / _up;
+                double weight = scale * sinc(scale * t) * kaiser_window(t / _radius, RESAMPLER_KAISER_BETA);
+                coeffs[k] = weight;
+                sum += weight;
+            }
 
-            // Get the source frame
-            unsigned src_f = time;
-            double P = scale * (time - src_f);
+            // Normalize each phase so that a constant signal keeps its level
+            for (unsigned k = 0; k < _taps; k++) {
+                coeffs[k] /= sum;
+            }
+        }
+    }
 
-            // Calculate filter offset and interpolation factor
-            double P_frac = P * FILTER_PRECISION;
-            unsigned l = P_frac;
-            double interp = P_frac - l;
+    bool Resampler::is_bypass() const { return _up == 1 && _down == 1; }
 
-            // Left wing
-            for (unsigned i = 0; i < FILTER_HALF_LENGTH; i++) {
-                int s_i = src_f - i;
-                int h_i = l + i * filter_step;
-                if (s_i < 0 || h_i >= static_cast<int>(FILTER_HALF_LENGTH)) break;
-                double weight = FILTER_RWING[h_i] + interp * FILTER_DIFFS[h_i];
-                dst_sample += src[s_i] * weight;
-            }
+    double Resampler::ratio() const { return static_cast<double>(_down) / _up; }
+
+    unsigned Resampler::radius() const { return _radius; }
 
-            // Invert
-            P = scale - P;
+    void Resampler::process(const Buffer &src, Buffer &dst, double time) const {
+        DYN_ASSERT(src.channels() == dst.channels());
+        int src_frames = src.frames();
+        int dst_frames = dst.frames();
 
-            // Calculate filter offset and interpolation factor
-            P_frac = P * FILTER_PRECISION;
-            l = P_frac;
-            interp = P_frac - l;
+        // Split the position into a source frame and a filter phase
+        int frame = std::floor(time);
+        unsigned phase = std::round((time - frame) * _up);
+        if (phase == _up) {
+            frame++;
+            phase = 0;
+        }
 
-            // Right wing
-            for (unsigned i = 0; i < FILTER_HALF_LENGTH; i++) {
-                int s_i = src_f + i + 1;
-                int h_i = l + i * filter_step;
-                if (s_i >= time_end || h_i >= static_cast<int>(FILTER_HALF_LENGTH)) break;
-                double weight = FILTER_RWING[h_i] + interp * FILTER_DIFFS[h_i];
-                dst_sample += src[s_i] * weight;
+        // Copy the overlapping range when the rates match
+        if (is_bypass()) {
+            int lo = std::clamp(-frame, 0, dst_frames);
+            int hi = std::clamp(src_frames - frame, lo, dst_frames);
+            for (unsigned c = 0; c < dst.channels(); c++) {
+                std::fill(dst[c], dst[c] + dst_frames, 0);
+                if (lo < hi) {
+                    std::copy(src[c] + frame + lo, src[c] + frame + hi, dst[c] + lo);
+                }
             }
+            return;
+        }
 
-            // Set the new sample
-            dst[dst_f] = dst_sample;
+        for (int f = 0; f < dst_frames; f++) {
+            const float *coeffs = _bank.data() + phase * _taps;
+            int start = frame + 1 - static_cast<int>(_radius);
+            if (start >= 0 && start + static_cast<int>(_taps) <= src_frames) {
+                for (unsigned c = 0; c < dst.channels(); c++) {
+                    dst[c][f] = Vectorize::vdot(src[c] + start, coeffs, _taps);
+                }
+            } else {
+                // Only use the taps that overlap the source near its edges
+                int lo = std::clamp(-start, 0, static_cast<int>(_taps));
+                int hi = std::clamp(src_frames - start, lo, static_cast<int>(_taps));
+                for (unsigned c = 0; c < dst.channels(); c++) {
+                    dst[c][f] = lo < hi ? Vectorize::vdot(src[c] + start + lo, coeffs + lo, hi - lo) : 0;
+                }
+            }
 
-            // Increment time
-            time += time_increment;
+            // Advance to the next output position
+            phase += _down;
+            frame += phase / _up;
+            phase %= _up;
         }
     }
-} // namespace Dynamo::Sound
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,28 +1,30 @@
 #pragma once
 #define _USE_MATH_DEFINES
 
-#include <array>
+#include <cmath>
+#include <vector>
 
 #include <Sound/Buffer.hpp>
 
 namespace Dynamo::Sound {
     /**
-     * @brief Number of zero-crossings in the filter
+     * @brief Number of zero-crossings on each side of the interpolation filter
      *
      */
-    static constexpr unsigned FILTER_ZERO_CROSSINGS = 32;
+    static constexpr unsigned RESAMPLER_ZERO_CROSSINGS = 16;
 
     /**
-     * @brief Number of coefficients per zero crossing
+     * @brief Maximum number of filter phases. Ratios that need more phases
+     * are approximated.
      *
      */
-    static constexpr unsigned FILTER_PRECISION = 4;
+    static constexpr unsigned RESAMPLER_MAX_PHASES = 1024;
 
     /**
-     * @brief Length of one wing in the filter
+     * @brief Shape parameter of the Kaiser window applied to the filter
      *
      */
-    static constexpr unsigned FILTER_HALF_LENGTH = FILTER_ZERO_CROSSINGS * FILTER_PRECISION + 1;
+    static constexpr double RESAMPLER_KAISER_BETA = 8;
 
     /**
      * @brief Normalized sinc function
@@ -58,76 +60,75 @@ namespace Dynamo::Sound {
     /**
      * @brief Compute the Kaiser window
      *
-     * @param x
+     * @param x    Position in the window, in [-1, 1]
+     * @param beta Shape parameter
      * @return constexpr double
      */
-    constexpr double filter_window(double n, unsigned N = 35, double beta = 6) {
-        double m = 2.0 * n / N;
-        double num = i0(beta * std::sqrt(1 - m * m));
-        double den = i0(beta);
-        return num / den;
+    constexpr double kaiser_window(double x, double beta) {
+        if (x * x >= 1) return 0;
+        return i0(beta * std::sqrt(1 - x * x)) / i0(beta);
     }
 
     /**
-     * @brief Compulte the right-wing of the filter coefficients
+     * @brief Polyphase resampler for a fixed ratio between two sample rates.
      *
-     * @return constexpr std::array<double, FILTER_HALF_LENGTH>
-     */
-    constexpr std::array<double, FILTER_HALF_LENGTH> construct_filter_table() {
-        std::array<double, FILTER_HALF_LENGTH> coeffs = {0};
-        for (double l = 0; l < FILTER_HALF_LENGTH; l++) {
-            double f = l / FILTER_PRECISION;
-            coeffs[l] = sinc(f) * filter_window(l);
-        }
-        return coeffs;
-    }
-
-    /**
-     * @brief Compute the filter coefficient difference table
+     * The ratio is reduced to a fraction up / down, and a windowed-sinc
+     * filter is precomputed as a bank of single-precision coefficients for
+     * each of the up phases. Each output frame is then a single dot product
+     * between a phase of the bank and the source frames around it, shared by
+     * all channels.
      *
-     * @param coeffs
-     * @return constexpr std::array<double, FILTER_HALF_LENGTH>
-     */
-    constexpr std::array<double, FILTER_HALF_LENGTH>
-    construct_difference_table(const std::array<double, FILTER_HALF_LENGTH> &coeffs) {
-        std::array<double, FILTER_HALF_LENGTH> diffs = {0};
-        for (unsigned i = 0; i < FILTER_HALF_LENGTH - 1; i++) {
-            diffs[i] = coeffs[i + 1] - coeffs[i];
-        }
-        return diffs;
-    }
-
-    /**
-     * @brief Low pass filter coefficient table, precomputed on
-     * initialization
+     * If the rates are equal, the signal is copied without filtering.
      *
      */
-    static const std::array<double, FILTER_HALF_LENGTH> FILTER_RWING = construct_filter_table();
+    class Resampler {
+        unsigned _up;
+        unsigned _down;
+        unsigned _radius;
+        unsigned _taps;
+        std::vector<float> _bank;
 
-    /**
-     * @brief Difference table for filter coefficients, precomputed on
-     * initialization
-     *
-     */
-    static const std::array<double, FILTER_HALF_LENGTH> FILTER_DIFFS = construct_difference_table(FILTER_RWING);
+      public:
+        /**
+         * @brief Construct a new Resampler object.
+         *
+         * @param src_rate Source sample rate
+         * @param dst_rate Destination sample rate
+         */
+        Resampler(double src_rate = STANDARD_SAMPLE_RATE, double dst_rate = STANDARD_SAMPLE_RATE);
 
-    /**
-     * @brief Change the sample rate of a signal
-     *
-     * This routine implements the algorithm described in
-     * https://ccrma.stanford.edu/~jos/resample/
-     *
-     * @param src         Signal source buffer
-     * @param dst         Signal destination buffer
-     * @param time_offset Frame offset in the signal source
-     * @param src_length  Length of the signal source
-     * @param src_rate    Source sample rate
-     * @param dst_rate    Destination sample rate
-     */
-    void resample_signal(WaveSample *src,
-                         WaveSample *dst,
-                         double time_offset,
-                         double src_length,
-                         double src_rate,
-                         double dst_rate);
+        /**
+         * @brief Check if the signal is copied without resampling.
+         *
+         * @return true
+         * @return false
+         */
+        bool is_bypass() const;
+
+        /**
+         * @brief Get the number of source frames per destination frame.
+         *
+         * @return double
+         */
+        double ratio() const;
+
+        /**
+         * @brief Get the number of source frames read on either side of a position.
+         *
+         * @return unsigned
+         */
+        unsigned radius() const;
+
+        /**
+         * @brief Resample all channels of a signal.
+         *
+         * This fills every frame of the destination. Source frames outside of
+         * the source buffer are treated as silence.
+         *
+         * @param src  Source buffer
+         * @param dst  Destination buffer with the same number of channels
+         * @param time Frame offset in the source
+         */
+        void process(const Buffer &src, Buffer &dst, double time) const;
+    };
 } // namespace Dynamo::Sound
\ No newline at end of file
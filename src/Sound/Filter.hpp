@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <Sound/Buffer.hpp>
 #include <Sound/Listener.hpp>
 
@@ -26,6 +28,51 @@ namespace Dynamo::Sound {
          * @return Sound&
          */
         virtual void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) = 0;
+
+        /**
+         * @brief Estimate the gain the filter will apply to a source.
+         *
+         * This is used to cull inaudible sources before processing them, so
+         * it should be cheap and should not underestimate.
+         *
+         * @param source
+         * @param listener
+         * @return float
+         */
+        virtual float estimate_gain(const Source &source, const Listener &listener) { return 1; }
+
+        /**
+         * @brief Get the largest number of channels the filter writes to its destination.
+         *
+         * The mixer sizes its scratch buffers with this before the filter
+         * runs, so that applying it does not allocate.
+         *
+         * @param channels Number of input channels
+         * @return unsigned
+         */
+        virtual unsigned output_channels(unsigned channels) const { return channels; }
+
+        /**
+         * @brief Append the filter and every filter it applies to a list.
+         *
+         * Filters keep state, so the mixer runs all sources that reach the
+         * same filter on the same worker.
+         *
+         * @param filters
+         */
+        virtual void collect(std::vector<Filter *> &filters) { filters.push_back(this); }
+
+        /**
+         * @brief Prepare for the parameters of a source before they are published to the mixer.
+         *
+         * This is called on the thread that plays the source, so unlike apply()
+         * it may block or allocate, e.g., to compute data the filter looks up
+         * while mixing.
+         *
+         * @param source
+         * @param listener
+         */
+        virtual void prepare(const Source &source, const Listener &listener) {}
     };
 
     /**
@@ -0,0 +1,96 @@
+#include <cmath>
+
+#include <Math/Common.hpp>
+#include <Math/Vectorize.hpp>
+#include <Sound/DSP/HRTF.hpp>
+#include <Sound/Filters/AmbisonicDecoder.hpp>
+#include <Sound/Jukebox.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    AmbisonicDecoder::AmbisonicDecoder(unsigned order) :
+        _order(order), _channels(ambisonic_channels(order)), _convolvers(_channels), _rotation(order),
+        _started(false), _rotated(MAX_CHUNK_LENGTH, _channels), _ears(MAX_CHUNK_LENGTH, 2) {
+        DYN_ASSERT(order <= AMBISONIC_MAX_ORDER);
+        _matrix.resize(_channels * _channels);
+        _previous.resize(_channels * _channels);
+
+        // Project the HRIRs of the virtual speakers onto each channel, weighted for SN3D
+        HRTF hrtf;
+        Buffer hrir(HRIR_LENGTH, 2);
+        Buffer responses(HRIR_LENGTH, 2 * _channels);
+        responses.silence();
+        std::vector<float> gains(_channels);
+        for (unsigned s = 0; s < AMBISONIC_VIRTUAL_SPEAKERS; s++) {
+            Vec3 speaker = sphere_point(s, AMBISONIC_VIRTUAL_SPEAKERS);
+            ambisonic_gains(speaker, order, gains.data());
+
+            // Interaural-polar coordinates of the speaker, with the elevation in [-90, 270)
+            float azimuth = to_degrees(std::asin(-speaker.y));
+            float elevation = to_degrees(std::atan2(speaker.z, speaker.x));
+            if (elevation < -90) {
+                elevation += 360;
+            }
+            hrtf.calculate_HRIR(Vec2(azimuth, elevation), hrir);
+            for (unsigned c = 0; c < _channels; c++) {
+                unsigned degree = std::sqrt(c);
+                float weight = (2 * degree + 1) * gains[c] / AMBISONIC_VIRTUAL_SPEAKERS;
+                Vectorize::vsma(hrir[0], weight, responses[2 * c], HRIR_LENGTH);
+                Vectorize::vsma(hrir[1], weight, responses[2 * c + 1], HRIR_LENGTH);
+            }
+        }
+        for (unsigned c = 0; c < _channels; c++) {
+            _convolvers[c].set_response(
+                std::make_shared<const ImpulseResponse>(responses[2 * c], responses[2 * c + 1], HRIR_LENGTH),
+                false);
+        }
+    }
+
+    void AmbisonicDecoder::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
+        DYN_ASSERT(src.channels() == _channels);
+        unsigned frames = src.frames();
+
+        // Rotate into the listener axes, ramping from the previous rotation
+        std::swap(_matrix, _previous);
+        _rotation.compute(listener.rotation, _matrix.data());
+        if (!_started) {
+            _previous = _matrix;
+            _started = true;
+        }
+
+        _rotated.resize(frames, _channels);
+        _rotated.silence();
+        float scale = frames > 0 ? 1.0f / frames : 0;
+        for (unsigned row = 0; row < _channels; row++) {
+            // Orders do not mix, so only the channels of the same degree contribute
+            unsigned degree = std::sqrt(row);
+            unsigned begin = degree * degree;
+            unsigned end = (degree + 1) * (degree + 1);
+            WaveSample *rotated = _rotated[row];
+            for (unsigned col = begin; col < end; col++) {
+                float gain = _previous[row * _channels + col];
+                float step = (_matrix[row * _channels + col] - gain) * scale;
+                const WaveSample *channel = src[col];
+                if (step == 0) {
+                    Vectorize::vsma(channel, gain, rotated, frames);
+                    continue;
+                }
+                for (unsigned f = 0; f < frames; f++) {
+                    rotated[f] += channel[f] * (gain + step * f);
+                }
+            }
+        }
+
+        // Convolve each channel with its binaural response
+        dst.resize(frames, 2);
+        dst.silence();
+        _ears.resize(frames, 2);
+        for (unsigned c = 0; c < _channels; c++) {
+            _convolvers[c].compute(_rotated[c], _ears[0], _ears[1], frames);
+            Vectorize::vadd(_ears[0], dst[0], dst[0], frames);
+            Vectorize::vadd(_ears[1], dst[1], dst[1], frames);
+        }
+    }
+
+    unsigned AmbisonicDecoder::output_channels(unsigned channels) const { return 2; }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include <Sound/DSP/Ambisonics.hpp>
+#include <Sound/DSP/Convolver.hpp>
+#include <Sound/Filter.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of virtual speakers sampled from the HRTF to build the
+     * binaural decoder
+     *
+     */
+    static constexpr unsigned AMBISONIC_VIRTUAL_SPEAKERS = 50;
+
+    /**
+     * @brief Binaural decoder of an ambisonic signal in world axes.
+     *
+     * The signal is rotated into the axes of the listener and convolved with
+     * one stereo response per ambisonic channel. The responses are computed
+     * once by projecting the HRIRs of a sphere of virtual speakers onto the
+     * spherical harmonics, so the cost does not depend on the number of
+     * encoded sources.
+     *
+     * This should be the filter of a Bus with ambisonic_channels(order)
+     * channels, fed by sources with an AmbisonicEncoder of the same order.
+     *
+     */
+    class AmbisonicDecoder : public Filter {
+        unsigned _order;
+        unsigned _channels;
+        std::vector<Convolver> _convolvers;
+
+        AmbisonicRotation _rotation;
+        std::vector<float> _matrix;
+        std::vector<float> _previous;
+        bool _started;
+
+        Buffer _rotated;
+        Buffer _ears;
+
+      public:
+        /**
+         * @brief Construct a new AmbisonicDecoder object.
+         *
+         * @param order Ambisonic order, up to AMBISONIC_MAX_ORDER
+         */
+        AmbisonicDecoder(unsigned order = 1);
+
+        void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <Math/Vectorize.hpp>
+#include <Sound/Filters/AmbisonicEncoder.hpp>
+#include <Sound/Jukebox.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    AmbisonicEncoder::AmbisonicEncoder(unsigned order) : _order(order), _started(false), _mono(MAX_CHUNK_LENGTH, 1) {
+        DYN_ASSERT(order <= AMBISONIC_MAX_ORDER);
+        _gains.resize(ambisonic_channels(order));
+        _previous.resize(ambisonic_channels(order));
+    }
+
+    void AmbisonicEncoder::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
+        unsigned channels = _gains.size();
+        unsigned frames = src.frames();
+
+        // Ramp from the previous gains to avoid clicks as the source moves
+        std::swap(_gains, _previous);
+        ambisonic_gains(to_ambisonic(source.parameters().position - listener.position), _order, _gains.data());
+        if (!_started) {
+            _previous = _gains;
+            _started = true;
+        }
+
+        // Downmix the source buffer to mono
+        _mono.resize(frames, 1);
+        _mono.silence();
+        src.remix(_mono);
+
+        // Resize the destination buffer
+        dst.resize(frames, channels);
+
+        const WaveSample *mono = _mono[0];
+        float scale = frames > 0 ? 1.0f / frames : 0;
+        for (unsigned c = 0; c < channels; c++) {
+            float gain = _previous[c];
+            float step = (_gains[c] - _previous[c]) * scale;
+            if (step == 0) {
+                Vectorize::smul(mono, gain, dst[c], frames);
+                continue;
+            }
+            WaveSample *channel = dst[c];
+            for (unsigned f = 0; f < frames; f++) {
+                channel[f] = mono[f] * (gain + step * f);
+            }
+        }
+    }
+
+    unsigned AmbisonicEncoder::output_channels(unsigned channels) const { return _gains.size(); }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include <Sound/DSP/Ambisonics.hpp>
+#include <Sound/Filter.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Encode a source into an ambisonic signal from its direction to
+     * the listener in world axes.
+     *
+     * This only applies a gain per channel, so it is cheap enough for every
+     * source. The result should be routed into a Bus with the same number of
+     * channels and an AmbisonicDecoder, which spatializes all of its sources
+     * at once.
+     *
+     * Gains are ramped from the previous chunk to avoid zipper noise, and
+     * that state is kept per encoder. Each source therefore needs its own
+     * encoder. Sharing one between sources would ramp from the direction of
+     * the previous source.
+     *
+     */
+    class AmbisonicEncoder : public Filter {
+        unsigned _order;
+        std::vector<float> _gains;
+        std::vector<float> _previous;
+        bool _started;
+
+        Buffer _mono;
+
+      public:
+        /**
+         * @brief Construct a new AmbisonicEncoder object.
+         *
+         * @param order Ambisonic order, up to AMBISONIC_MAX_ORDER
+         */
+        AmbisonicEncoder(unsigned order = 1);
+
+        void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
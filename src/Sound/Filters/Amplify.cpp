@@ -8,4 +8,6 @@ namespace Dynamo::Sound {
             Vectorize::smul(src[c], gain, dst[c], src.frames());
         }
     }
+
+    float Amplify::estimate_gain(const Source &source, const Listener &listener) { return gain; }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -15,5 +15,7 @@ namespace Dynamo::Sound {
         float gain = 1;
 
         void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        float estimate_gain(const Source &source, const Listener &listener) override;
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
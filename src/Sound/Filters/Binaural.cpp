@@ -1,10 +1,23 @@
 #include <Sound/Filters/Binaural.hpp>
+#include <Sound/Jukebox.hpp>
 #include <Sound/Source.hpp>
 
 namespace Dynamo::Sound {
+    Binaural::Binaural(HRIRCache &cache) : _cache(cache), _mono(MAX_CHUNK_LENGTH, 1) {
+        // Size the frequency-delay line for the responses, so the first one does not allocate while mixing
+        _convolver.set_response(_cache.get(0), false);
+    }
+
     void Binaural::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
-        _impulse_response.resize(HRIR_LENGTH, 2);
-        _hrtf.calculate_HRIR(listener.position, listener.rotation, source.position, _impulse_response);
+        // Update the impulse response only if the quantized direction changed and has been prepared
+        unsigned direction = _cache.direction(listener.position, listener.rotation, source.parameters().position);
+        if (direction != _direction) {
+            std::shared_ptr<const ImpulseResponse> response = _cache.find(direction);
+            if (response) {
+                _convolver.set_response(std::move(response), _direction.has_value());
+                _direction = direction;
+            }
+        }
 
         // Downmix the source buffer to mono
         _mono.resize(src.frames(), 1);
@@ -14,12 +27,13 @@ namespace Dynamo::Sound {
         // Resize the destination buffer
         dst.resize(src.frames(), 2);
 
-        // Initialize channel convolvers
-        _convolvers[0].initialize(_impulse_response[0], _impulse_response.frames());
-        _convolvers[1].initialize(_impulse_response[1], _impulse_response.frames());
+        // Convolve both ears against the same transformed input
+        _convolver.compute(_mono[0], dst[0], dst[1], src.frames());
+    }
 
-        // Apply convolution
-        _convolvers[0].compute(_mono[0], dst[0], src.frames());
-        _convolvers[1].compute(_mono[0], dst[1], src.frames());
+    void Binaural::prepare(const Source &source, const Listener &listener) {
+        _cache.get(_cache.direction(listener.position, listener.rotation, source.position));
     }
+
+    unsigned Binaural::output_channels(unsigned channels) const { return 2; }
 } // namespace Dynamo::Sound
\ No newline at end of file
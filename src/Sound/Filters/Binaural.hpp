@@ -1,24 +1,43 @@
 #pragma once
 
-#include <array>
+#include <optional>
 
 #include <Sound/DSP/Convolver.hpp>
-#include <Sound/DSP/HRTF.hpp>
+#include <Sound/DSP/HRIRCache.hpp>
 #include <Sound/Filter.hpp>
 
 namespace Dynamo::Sound {
     /**
      * @brief Binaural spatial sound implementation using HRTF.
      *
+     * Impulse responses are looked up per quantized direction from a cache
+     * shared between sources, and the convolution is only updated when the
+     * direction changes, crossfading from the previous response.
+     *
+     * Responses are computed on the thread that plays the source when the
+     * Jukebox commits, so mixing only looks them up. If a direction is not
+     * ready yet, the previous response is kept until it is.
+     *
      */
     class Binaural : public Filter {
-        HRTF _hrtf;
-        std::array<Convolver, 2> _convolvers;
+        HRIRCache &_cache;
+        Convolver _convolver;
+        std::optional<unsigned> _direction;
 
-        Buffer _impulse_response;
         Buffer _mono;
 
       public:
+        /**
+         * @brief Construct a new Binaural object.
+         *
+         * @param cache Cache of impulse responses
+         */
+        Binaural(HRIRCache &cache = HRIRCache::shared());
+
         void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        void prepare(const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include <Sound/Filters/Biquad.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    Biquad::Biquad(const std::vector<BiquadCoefficients> &sections, unsigned channels) :
+        _sections(sections), _bank(channels, sections.size()) {
+        for (unsigned s = 0; s < _sections.size(); s++) {
+            _bank.set(s, _sections[s]);
+        }
+    }
+
+    unsigned Biquad::sections() const { return _sections.size(); }
+
+    void Biquad::set_section(unsigned section, const BiquadCoefficients &coefficients) {
+        DYN_ASSERT(section < _sections.size());
+        _sections[section] = coefficients;
+        _bank.set(section, coefficients);
+    }
+
+    void Biquad::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
+        // Rebuild the bank if the source layout changes, the previous state does not carry over
+        if (_bank.channels() != src.channels()) {
+            _bank = BiquadBank(src.channels(), _sections.size());
+            for (unsigned s = 0; s < _sections.size(); s++) {
+                _bank.set(s, _sections[s]);
+            }
+        }
+        _bank.process(src, dst);
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/BiquadBank.hpp>
+#include <Sound/Filter.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Cascade of biquad sections applied to every channel, e.g., a
+     * low-pass for occlusion, an equalizer, or a high-pass.
+     *
+     * Changing a section while playing interpolates its coefficients over
+     * the next chunk.
+     *
+     * Filters are applied one source at a time, so only the channels of that
+     * source share the SIMD lanes of the bank. A mono source leaves the other
+     * lanes idle.
+     *
+     */
+    class Biquad : public Filter {
+        std::vector<BiquadCoefficients> _sections;
+        BiquadBank _bank;
+
+      public:
+        /**
+         * @brief Construct a new Biquad object.
+         *
+         * The filter state is sized for sources with the given number of
+         * channels. Other sources rebuild it, which allocates while mixing.
+         *
+         * @param sections Coefficients of each cascaded section
+         * @param channels Number of channels of the filtered sources
+         */
+        Biquad(const std::vector<BiquadCoefficients> &sections = {BiquadCoefficients()}, unsigned channels = 1);
+
+        /**
+         * @brief Get the number of cascaded sections.
+         *
+         * @return unsigned
+         */
+        unsigned sections() const;
+
+        /**
+         * @brief Set the coefficients of a section.
+         *
+         * @param section
+         * @param coefficients
+         */
+        void set_section(unsigned section, const BiquadCoefficients &coefficients);
+
+        void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
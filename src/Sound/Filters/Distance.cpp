@@ -14,7 +14,7 @@ namespace Dynamo::Sound {
     }
 
     void Distance::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
-        float distance = (source.position - listener.position).length();
+        float distance = (source.parameters().position - listener.position).length();
         float gain = linear(distance);
 
         // Apply gain
@@ -22,4 +22,8 @@ namespace Dynamo::Sound {
             Vectorize::smul(src[c], gain, dst[c], src.frames());
         }
     }
+
+    float Distance::estimate_gain(const Source &source, const Listener &listener) {
+        return linear((source.parameters().position - listener.position).length());
+    }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -29,5 +29,7 @@ namespace Dynamo::Sound {
         float linear(float distance);
 
         void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        float estimate_gain(const Source &source, const Listener &listener) override;
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <Sound/Filters/FilterSequence.hpp>
 
 namespace Dynamo::Sound {
@@ -7,5 +9,36 @@ namespace Dynamo::Sound {
         }
     }
 
+    float FilterSequence::estimate_gain(const Source &source, const Listener &listener) {
+        float gain = 1;
+        for (Filter &filter : _sequence) {
+            gain *= filter.estimate_gain(source, listener);
+        }
+        return gain;
+    }
+
+    unsigned FilterSequence::output_channels(unsigned channels) const {
+        // Every filter writes to the same destination, so it must fit the widest one
+        unsigned widest = channels;
+        for (const Filter &filter : _sequence) {
+            channels = filter.output_channels(channels);
+            widest = std::max(widest, channels);
+        }
+        return widest;
+    }
+
+    void FilterSequence::collect(std::vector<Filter *> &filters) {
+        filters.push_back(this);
+        for (Filter &filter : _sequence) {
+            filter.collect(filters);
+        }
+    }
+
+    void FilterSequence::prepare(const Source &source, const Listener &listener) {
+        for (Filter &filter : _sequence) {
+            filter.prepare(source, listener);
+        }
+    }
+
     void FilterSequence::push(Filter &filter) { _sequence.emplace_back(filter); }
 } // namespace Dynamo::Sound
\ No newline at end of file
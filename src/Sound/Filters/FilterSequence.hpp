@@ -13,6 +13,14 @@ namespace Dynamo::Sound {
       public:
         void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
 
+        float estimate_gain(const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
+
+        void collect(std::vector<Filter *> &filters) override;
+
+        void prepare(const Source &source, const Listener &listener) override;
+
         /**
          * @brief Add a filter.
          *
@@ -0,0 +1,41 @@
+#include <Math/Vectorize.hpp>
+#include <Sound/Filters/Reverb.hpp>
+#include <Sound/Jukebox.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    Reverb::Reverb(const Buffer &impulse_response, double sample_rate) :
+        _convolver(impulse_response, sample_rate), _mono(MAX_CHUNK_LENGTH, 1),
+        _dry(MAX_CHUNK_LENGTH, _convolver.channels()) {}
+
+    void Reverb::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
+        unsigned channels = _convolver.channels();
+
+        // Downmix the source buffer to mono
+        _mono.resize(src.frames(), 1);
+        _mono.silence();
+        src.remix(_mono);
+
+        // Keep the unprocessed signal before the destination is overwritten
+        if (dry != 0) {
+            _dry.resize(src.frames(), channels);
+            _dry.silence();
+            _mono.remix(_dry);
+        }
+
+        // Resize the destination buffer
+        dst.resize(src.frames(), channels);
+
+        _convolver.compute(_mono[0], dst, src.frames());
+        for (unsigned c = 0; c < channels; c++) {
+            if (wet != 1) {
+                Vectorize::smul(dst[c], wet, dst[c], src.frames());
+            }
+            if (dry != 0) {
+                Vectorize::vsma(_dry[c], dry, dst[c], src.frames());
+            }
+        }
+    }
+
+    unsigned Reverb::output_channels(unsigned channels) const { return _convolver.channels(); }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/NonUniformConvolver.hpp>
+#include <Sound/Filter.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Convolution reverb for long impulse responses, e.g., recorded
+     * rooms spanning several seconds.
+     *
+     * The output has the channels of the impulse response.
+     *
+     * The tail is convolved on the DeadlineScheduler workers. Applying the
+     * filter does not lock or allocate, but the mixer may still stall while
+     * it waits on or inlines a late tail segment, so long responses need
+     * spare cores to stay within the callback's deadline.
+     *
+     */
+    class Reverb : public Filter {
+        NonUniformConvolver _convolver;
+
+        Buffer _mono;
+        Buffer _dry;
+
+      public:
+        /**
+         * @brief Gain of the unprocessed signal.
+         *
+         */
+        float dry = 0;
+
+        /**
+         * @brief Gain of the convolved signal.
+         *
+         */
+        float wet = 1;
+
+        /**
+         * @brief Construct a new Reverb object.
+         *
+         * @param impulse_response Impulse response with 1 or 2 channels
+         * @param sample_rate      Sample rate of the mixer
+         */
+        Reverb(const Buffer &impulse_response, double sample_rate = STANDARD_SAMPLE_RATE);
+
+        void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
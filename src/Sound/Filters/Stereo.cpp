@@ -1,10 +1,13 @@
 #include <Math/Vectorize.hpp>
 #include <Sound/Filters/Stereo.hpp>
+#include <Sound/Jukebox.hpp>
 #include <Sound/Source.hpp>
 
 namespace Dynamo::Sound {
+    Stereo::Stereo() : _mono(MAX_CHUNK_LENGTH, 1) {}
+
     void Stereo::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
-        Vec3 delta = source.position - listener.position;
+        Vec3 delta = source.parameters().position - listener.position;
         Vec3 up = listener.rotation.up();
         Vec3 right = listener.rotation.right();
         Vec3 displacement = (delta - up * (delta * up));
@@ -29,4 +32,6 @@ namespace Dynamo::Sound {
         Vectorize::smul(_mono[0], std::sqrt(1.0f - pan), dst[0], src.frames());
         Vectorize::smul(_mono[0], std::sqrt(pan), dst[1], src.frames());
     }
+
+    unsigned Stereo::output_channels(unsigned channels) const { return 2; }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -12,6 +12,14 @@ namespace Dynamo::Sound {
         Buffer _mono;
 
       public:
+        /**
+         * @brief Construct a new Stereo object.
+         *
+         */
+        Stereo();
+
         void apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) override;
+
+        unsigned output_channels(unsigned channels) const override;
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
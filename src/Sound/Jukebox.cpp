@@ -1,26 +1,15 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
 #include <Math/Vectorize.hpp>
 #include <Sound/DSP/Resample.hpp>
 #include <Sound/Jukebox.hpp>
 #include <Sound/Listener.hpp>
 
 namespace Dynamo::Sound {
-    Jukebox::Jukebox() {
-        // Initialize state
-        _input_stream = nullptr;
-        _input_state.channels = 0;
-
-        _output_stream = nullptr;
-        _output_state.channels = 0;
-
-        _volume = 1.0f;
-
-        // Initialize PortAudio
-        PaError err;
-        err = Pa_Initialize();
-        if (err != paNoError) {
-            Log::error("Could not initialize PortAudio subsystem: {}", Pa_GetErrorText(err));
-        }
-
+    Jukebox::Jukebox() : Jukebox(2, STANDARD_SAMPLE_RATE) {
         // Set the default input and output devices
         devices();
         for (const Device &device : _devices) {
@@ -37,13 +26,53 @@ namespace Dynamo::Sound {
         }
 
         if (_output_stream == nullptr) {
-            Log::error("Jukebox could not find a suitable output device.");
+            Log::warn("Jukebox could not find a suitable output device, rendering offline.");
         }
     }
 
+    Jukebox::Jukebox(unsigned channels, double sample_rate, unsigned threads) :
+        _threads(threads > 0 ? threads : std::max(std::thread::hardware_concurrency(), 1U)),
+        _pool(std::max(_threads, 2U) - 1) {
+        // Initialize state
+        _input_stream = nullptr;
+        _input_state.channels = 0;
+        _input_state.target_length = 0;
+
+        _output_stream = nullptr;
+        _output_state.channels = 0;
+        _output_state.target_length = 0;
+
+        _volume = 1.0f;
+        _latency = DEFAULT_LATENCY;
+        _realtime = false;
+        _mixing = 0;
+        _pending_offset = 0;
+        _pending_frames = 0;
+
+        // The audio thread mixes alongside the pool workers, sharing a fixed number of partitions
+        _mixers.resize(MIX_PARTITIONS);
+
+        // Initialize PortAudio
+        PaError err;
+        err = Pa_Initialize();
+        if (err != paNoError) {
+            Log::error("Could not initialize PortAudio subsystem: {}", Pa_GetErrorText(err));
+        }
+
+        // Render offline until an output device is set
+        configure_output(channels, sample_rate);
+        commit();
+    }
+
     Jukebox::~Jukebox() {
         PaError err;
 
+        // Sources that outlive the Jukebox stop playing and have nothing to detach from
+        for (Source *source : _attached) {
+            source->_playing = false;
+            source->_jukebox = nullptr;
+        }
+
         // Close the IO streams
         if (_input_stream) {
             err = Pa_CloseStream(_input_stream);
@@ -71,8 +100,18 @@ namespace Dynamo::Sound {
                                 const PaStreamCallbackTimeInfo *time_info,
                                 PaStreamCallbackFlags status_flags,
                                 void *data) {
-        PaState *state = static_cast<PaState *>(data);
-        state->buffer.write(static_cast<const WaveSample *>(input), frame_count * state->channels);
+        Jukebox *jukebox = static_cast<Jukebox *>(data);
+        PaState *state = &jukebox->_input_state;
+        unsigned length = frame_count * state->channels;
+        unsigned count = state->buffer.write(static_cast<const WaveSample *>(input), length);
+
+        Counters &counters = jukebox->_counters;
+        if (status_flags & paInputUnderflow) {
+            counters.input_underflows.fetch_add(1, std::memory_order_relaxed);
+        }
+        if ((status_flags & paInputOverflow) || count < length) {
+            counters.input_overflows.fetch_add(1, std::memory_order_relaxed);
+        }
         return 0;
     }
 
@@ -82,54 +121,471 @@ namespace Dynamo::Sound {
                                  const PaStreamCallbackTimeInfo *time_info,
                                  PaStreamCallbackFlags status_flags,
                                  void *data) {
-        PaState *state = static_cast<PaState *>(data);
-        state->buffer.read(static_cast<WaveSample *>(output), frame_count * state->channels);
+        Jukebox *jukebox = static_cast<Jukebox *>(data);
+        PaState *state = &jukebox->_output_state;
+        WaveSample *dst = static_cast<WaveSample *>(output);
+        unsigned length = frame_count * state->channels;
+
+        Counters &counters = jukebox->_counters;
+        if (status_flags & paOutputUnderflow) {
+            counters.output_underflows.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (status_flags & paOutputOverflow) {
+            counters.output_overflows.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Mix directly into the device buffer
+        if (jukebox->_realtime.load(std::memory_order_acquire)) {
+            jukebox->render(dst, frame_count);
+            return 0;
+        }
+
+        // Frames left over from real-time mode are stale once buffered output resumes
+        jukebox->_pending_frames = 0;
+
+        // Silence whatever could not be filled from the ring buffer
+        unsigned count = state->buffer.read(dst, length);
+        std::fill(dst + count, dst + length, 0);
+        if (count < length) {
+            counters.dropped_frames.fetch_add((length - count) / state->channels, std::memory_order_relaxed);
+        }
+
+        // Wake the mixer once there is room for another chunk below the target.
+        // This does not take the lock, so a wakeup can be missed if the mixer is
+        // about to sleep, but the next callback will signal it again.
+        unsigned chunk_length = MAX_CHUNK_LENGTH * state->channels;
+        if (state->buffer.size() + chunk_length <= state->target_length.load(std::memory_order_relaxed)) {
+            state->signal.notify_one();
+        }
         return 0;
     }
 
-    void Jukebox::process_source(Source &source) {
-        // Calculate the number of frames in the destination buffer
-        Buffer &buffer = source._buffer;
-        double frame_stop = std::min(source._frame + MAX_CHUNK_LENGTH, static_cast<double>(buffer.frames()));
-        double frames = frame_stop - source._frame;
+    /**
+     * @brief Mix a signal onto a destination, remixing it to the destination channels.
+     *
+     * @param src     Source signal
+     * @param gain    Volume multiplier
+     * @param dst     Destination
+     * @param remixed Scratch buffer
+     */
+    static void mix_signal(const Buffer &src, float gain, Buffer &dst, Buffer &remixed) {
+        const Buffer *signal = &src;
+        if (src.channels() != dst.channels()) {
+            remixed.resize(src.frames(), dst.channels());
+            remixed.silence();
+            src.remix(remixed);
+            signal = &remixed;
+        }
+        for (unsigned c = 0; c < dst.channels(); c++) {
+            Vectorize::vsma((*signal)[c], gain, dst[c], src.frames());
+        }
+    }
+
+    /**
+     * @brief Get the nanoseconds elapsed since a time point and move it to the current time.
+     *
+     * @param start
+     * @return uint64_t
+     */
+    static uint64_t lap(std::chrono::steady_clock::time_point &start) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count();
+        start = now;
+        return elapsed;
+    }
+
+    void Jukebox::process_source(Source &source,
+                                 const Resampler &resampler,
+                                 const Listener &listener,
+                                 float volume,
+                                 unsigned frame_count,
+                                 Mixer &mixer,
+                                 const BusSchedule &schedule,
+                                 std::vector<Buffer> &bus_mixes) {
+        std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
 
-        // Calculate the number of frames required to process
-        double factor = STANDARD_SAMPLE_RATE / _output_state.sample_rate;
-        double length = frames * factor;
+        // Calculate the number of frames in the destination buffer and the source frames they span
+        unsigned frames = source_frames(source, resampler, frame_count);
+        double length = frames * resampler.ratio();
 
-        // Resample to the device sample rate
-        _scratch.resize(frames, buffer.channels());
-        for (unsigned c = 0; c < buffer.channels(); c++) {
-            resample_signal(buffer[c],
-                            _scratch[c],
-                            source._frame,
-                            length,
-                            STANDARD_SAMPLE_RATE,
-                            _output_state.sample_rate);
+        // Streams and compressed buffers are read into a window spanning the chunk and the resampling
+        // filter on either side
+        double offset = source._frame;
+        if (!source._buffer.has_value()) {
+            unsigned radius = resampler.radius();
+            unsigned first = std::max(std::floor(source._frame) - radius, 0.0);
+            unsigned end = std::ceil(source._frame + length) + radius + 1;
+            if (source._stream.has_value()) {
+                Stream &stream = source._stream.value();
+                mixer.window.resize(end - first, stream.channels());
+                stream.read(first, mixer.window);
+            } else {
+                const CompressedBuffer &compressed = source._compressed.value();
+                mixer.window.resize(end - first, compressed.channels());
+                compressed.decode(first, mixer.window);
+            }
+            offset -= first;
         }
+        Buffer &buffer = source._buffer.has_value() ? source._buffer.value().get() : mixer.window;
+
+        // Resample from the native sample rate to the device sample rate in a single pass
+        Buffer &scratch = mixer.scratch;
+        scratch.resize(frames, buffer.channels());
+        resampler.process(buffer, scratch, offset);
+        mixer.resample_time += lap(time);
 
         // Apply the filters
         if (source._filter.has_value()) {
             Filter &filter = source._filter.value();
-            filter.apply(_scratch, _scratch, source, _listener);
+            filter.apply(scratch, scratch, source, listener);
         }
+        mixer.filter_time += lap(time);
 
-        // Remix to the output device channels
-        _remixed.resize(_scratch.frames(), _output_state.channels);
-        _remixed.silence();
-        _scratch.remix(_remixed);
+        // Mix the processed sound onto the composite signal or its bus, which applies the master volume
+        float gain = source.parameters().volume;
+        const Source::Playback &playback = source._playback.front();
+        if (playback.output == nullptr) {
+            mix_signal(scratch, volume * gain, mixer.composite, mixer.remixed);
+        } else {
+            auto it = schedule.indices.find(playback.output);
+            if (it != schedule.indices.end()) {
+                mix_signal(scratch, gain, bus_mixes[it->second], mixer.remixed);
+            }
+        }
 
-        // Mix the processed sound onto the composite signal
-        for (unsigned c = 0; c < _composite.channels(); c++) {
-            Vectorize::vsma(_remixed[c], _volume, _composite[c], _remixed.frames());
+        // Mix a scaled copy onto each send bus
+        for (const Source::Send &send : playback.sends) {
+            auto it = schedule.indices.find(send.bus);
+            if (it != schedule.indices.end()) {
+                mix_signal(scratch, gain * send.level, bus_mixes[it->second], mixer.remixed);
+            }
         }
+        mixer.remix_time += lap(time);
+        mixer.voice_chunks++;
 
         // Advance chunk frame
         source._frame += length;
     }
 
+    unsigned Jukebox::bus_channels(const Bus &bus) const {
+        return bus._channels > 0 ? bus._channels : _output_state.channels;
+    }
+
+    void Jukebox::schedule_buses(BusSchedule &schedule) {
+        // Index the added buses so that routes between them can be followed
+        schedule.indices.clear();
+        for (unsigned i = 0; i < _buses.size(); i++) {
+            schedule.indices.emplace(&_buses[i].get(), i);
+        }
+
+        // Count the hops from each bus to the master
+        _bus_order.clear();
+        for (Bus &bus : _buses) {
+            Bus *node = &bus;
+            unsigned depth = 0;
+            while (node != nullptr && node->_output.has_value()) {
+                node = &node->_output.value().get();
+                if (schedule.indices.find(node) == schedule.indices.end()) {
+                    node = nullptr;
+                } else if (++depth > _buses.size()) {
+                    Log::error("Jukebox bus routing has a cycle.");
+                }
+            }
+            if (node != nullptr) {
+                _bus_order.emplace_back(depth, &bus);
+            }
+        }
+        std::stable_sort(_bus_order.begin(), _bus_order.end(), [](const auto &a, const auto &b) {
+            return a.first > b.first;
+        });
+
+        // Split the buses into levels of equal depth
+        schedule.levels.clear();
+        schedule.indices.clear();
+        for (unsigned i = 0; i < _bus_order.size(); i++) {
+            if (i == 0 || _bus_order[i].first != _bus_order[i - 1].first) {
+                schedule.levels.push_back(i);
+            }
+            schedule.indices.emplace(_bus_order[i].second, i);
+        }
+        schedule.levels.push_back(_bus_order.size());
+
+        // Copy the routing of each bus and size its buffers, which are reused between schedules
+        unsigned bus_count = _bus_order.size();
+        schedule.buses.resize(bus_count);
+        for (unsigned i = 0; i < bus_count; i++) {
+            const Bus &bus = *_bus_order[i].second;
+            BusNode &node = schedule.buses[i];
+            node.bus = &bus;
+            node.filter = bus._filter;
+            node.source = &bus._source;
+            node.volume = bus.volume;
+            node.output = bus_count;
+
+            unsigned channels = _output_state.channels;
+            if (bus._output.has_value()) {
+                node.output = schedule.indices.find(&bus._output.value().get())->second;
+                channels = bus_channels(bus._output.value());
+            }
+            node.input.resize(MAX_CHUNK_LENGTH, bus_channels(bus));
+            node.mix.resize(MAX_CHUNK_LENGTH, channels);
+        }
+    }
+
+    void Jukebox::prepare_buses() {
+        for (Bus &bus : _buses) {
+            bus._source.position = _listener.position;
+            if (bus._filter.has_value()) {
+                bus._filter.value().get().prepare(bus._source, _listener);
+            }
+            bus._source.publish();
+        }
+    }
+
+    void Jukebox::process_bus(BusSchedule &schedule,
+                              unsigned index,
+                              unsigned input_begin,
+                              unsigned input_end,
+                              const Buffer &sources,
+                              const Listener &listener,
+                              unsigned frame_count) {
+        BusNode &node = schedule.buses[index];
+
+        // Sum the sources and the buses routed into this one in a fixed order
+        Buffer &input = node.input;
+        input.resize(frame_count, sources.channels());
+        for (unsigned c = 0; c < input.channels(); c++) {
+            std::copy(sources[c], sources[c] + frame_count, input[c]);
+        }
+        for (unsigned i = input_begin; i < input_end; i++) {
+            const BusNode &child = schedule.buses[i];
+            if (child.output == index) {
+                for (unsigned c = 0; c < input.channels(); c++) {
+                    Vectorize::vsma(child.mix[c], child.volume, input[c], frame_count);
+                }
+            }
+        }
+
+        // Apply the filter once to the summed signal, as heard at the listener
+        if (node.filter.has_value()) {
+            Filter &filter = node.filter.value();
+            filter.apply(input, input, *node.source, listener);
+        }
+
+        // Remix to the channels of the bus or device it feeds
+        node.mix.resize(frame_count, node.mix.channels());
+        node.mix.silence();
+        input.remix(node.mix);
+    }
+
+    void Jukebox::mix_buses(BusSchedule &schedule,
+                            const std::vector<Buffer> &bus_mixes,
+                            const Listener &listener,
+                            float volume,
+                            unsigned frame_count,
+                            Buffer &composite,
+                            bool parallel) {
+        for (unsigned l = 0; l + 1 < schedule.levels.size(); l++) {
+            unsigned begin = schedule.levels[l];
+            unsigned end = schedule.levels[l + 1];
+            unsigned input_begin = l > 0 ? schedule.levels[l - 1] : begin;
+
+            // Buses within a level are independent, the first one is processed on this thread
+            unsigned inline_end = parallel ? begin + 1 : end;
+            if (parallel) {
+                _jobs.clear();
+                for (unsigned i = inline_end; i < end; i++) {
+                    _jobs.push_back(_pool.submit([&, i, input_begin, begin]() {
+                        process_bus(schedule, i, input_begin, begin, bus_mixes[i], listener, frame_count);
+                    }));
+                }
+            }
+            for (unsigned i = begin; i < inline_end; i++) {
+                process_bus(schedule, i, input_begin, begin, bus_mixes[i], listener, frame_count);
+            }
+            if (parallel) {
+                for (std::future<void> &job : _jobs) {
+                    job.get();
+                }
+            }
+        }
+
+        // Mix the buses that feed the master onto the composite signal
+        for (const BusNode &node : schedule.buses) {
+            if (node.output == schedule.buses.size()) {
+                for (unsigned c = 0; c < composite.channels(); c++) {
+                    Vectorize::vsma(node.mix[c], volume * node.volume, composite[c], frame_count);
+                }
+            }
+        }
+    }
+
+    void Jukebox::prepare_resamplers(ResamplerMap &resamplers, const std::vector<SourceRef> &sources) {
+        for (const Source &source : sources) {
+            unsigned sample_rate = std::round(source.sample_rate());
+            if (resamplers.find(sample_rate) == resamplers.end()) {
+                auto resampler = std::make_shared<const Resampler>(sample_rate, _output_state.sample_rate);
+                resamplers.emplace(sample_rate, resampler);
+            }
+        }
+    }
+
+    const Resampler &Jukebox::find_resampler(const ResamplerMap &resamplers, const Source &source) const {
+        auto it = resamplers.find(std::round(source.sample_rate()));
+        DYN_ASSERT(it != resamplers.end());
+        return *it->second;
+    }
+
+    unsigned Jukebox::source_frames(const Source &source, const Resampler &resampler, unsigned frame_count) const {
+        double remaining = std::ceil((source._playback.front().frame_stop - source._frame) / resampler.ratio());
+        return std::min<double>(frame_count, std::max(remaining, 0.0));
+    }
+
+    void Jukebox::advance_source(Source &source, const Resampler &resampler, unsigned frame_count) {
+        source._frame += source_frames(source, resampler, frame_count) * resampler.ratio();
+    }
+
+    void Jukebox::render(WaveSample *dst, unsigned frame_count) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        unsigned callback_frames = frame_count;
+        _mixing.fetch_add(1);
+
+        // Pairs with the fence in detach(), so either the new snapshot is seen here or the chunk is waited for there
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Pick up the latest sources and parameters from the game thread
+        _snapshots.acquire();
+        MixSnapshot &snapshot = _snapshots.front();
+
+        // Voices are selected here since the callback owns the mixer's view of the source parameters
+        for (Source &source : snapshot.sources) {
+            source._playback.acquire();
+            apply_seek(source);
+        }
+        snapshot.voices.update(snapshot.sources, snapshot.listener, snapshot.volume);
+        const std::vector<Source *> &real_voices = snapshot.voices.real_voices();
+        const std::vector<Source *> &virtual_voices = snapshot.voices.virtual_voices();
+        _counters.real_voices.store(real_voices.size(), std::memory_order_relaxed);
+        _counters.virtual_voices.store(virtual_voices.size(), std::memory_order_relaxed);
+
+        // Play the rest of the chunk mixed by the previous callback
+        Mixer &mixer = snapshot.mixer;
+        Buffer &composite = mixer.composite;
+        unsigned channels = composite.channels();
+        unsigned stride = composite.frames();
+        unsigned pending = std::min(frame_count, _pending_frames);
+        const WaveSample *pending_begin = _pending.data() + _pending_offset * channels;
+        std::copy(pending_begin, pending_begin + pending * channels, dst);
+        dst += pending * channels;
+        frame_count -= pending;
+        _pending_offset += pending;
+        _pending_frames -= pending;
+
+        // Mix on the callback thread, waiting on the workers is not real-time safe. Filters only ever see whole
+        // chunks, so the last one is kept for the next callback if the device asks for fewer frames.
+        while (frame_count > 0) {
+            unsigned frames = MAX_CHUNK_LENGTH;
+
+            composite.silence();
+            for (Buffer &bus_mix : snapshot.bus_mixes) {
+                bus_mix.silence();
+            }
+            for (Source *source : real_voices) {
+                if (source->_frame < source->_playback.front().frame_stop) {
+                    process_source(*source,
+                                   find_resampler(snapshot.resamplers, *source),
+                                   snapshot.listener,
+                                   snapshot.volume,
+                                   frames,
+                                   mixer,
+                                   snapshot.buses,
+                                   snapshot.bus_mixes);
+                }
+            }
+            for (Source *source : virtual_voices) {
+                if (source->_frame < source->_playback.front().frame_stop) {
+                    advance_source(*source, find_resampler(snapshot.resamplers, *source), frames);
+                }
+            }
+            mix_buses(snapshot.buses, snapshot.bus_mixes, snapshot.listener, snapshot.volume, frames, composite, false);
+
+            // Clamp and interleave the composite into the device buffer
+            for (unsigned c = 0; c < channels; c++) {
+                Vectorize::vclamp(composite[c], -1, 1, composite[c], frames);
+            }
+            if (frame_count >= frames) {
+                Vectorize::vinterleave(composite.data(), stride, channels, dst, frames);
+                dst += frames * channels;
+                frame_count -= frames;
+            } else {
+                Vectorize::vinterleave(composite.data(), stride, channels, _pending.data(), frames);
+                std::copy(_pending.data(), _pending.data() + frame_count * channels, dst);
+                _pending_offset = frame_count;
+                _pending_frames = frames - frame_count;
+                frame_count = 0;
+            }
+        }
+
+        // Finished sources are removed by the game thread on its next update
+        for (Source &source : snapshot.sources) {
+            finish_source(source);
+        }
+
+        // The whole callback is measured against the time it takes to play
+        record_chunk(start, callback_frames, &mixer, 1);
+        _mixing.fetch_add(1);
+    }
+
+    void Jukebox::publish() {
+        MixSnapshot &snapshot = _snapshots.back();
+        snapshot.listener = _listener;
+        snapshot.volume = _volume;
+
+        // Scratch space for the voice selection is reserved here since the callback must not allocate
+        snapshot.sources = _sources;
+        snapshot.voices.set_max_voices(_voices.get_max_voices());
+        snapshot.voices.set_threshold(_voices.get_threshold());
+        snapshot.voices.reserve(_sources.size());
+        prepare_resamplers(_resamplers, _sources);
+        snapshot.resamplers = _resamplers;
+
+        // Bus scratch buffers are sized here since the callback must not allocate
+        unsigned channels = _output_state.channels;
+        unsigned mix_channels = channels;
+        schedule_buses(snapshot.buses);
+        snapshot.bus_mixes.resize(snapshot.buses.buses.size());
+        for (unsigned b = 0; b < snapshot.bus_mixes.size(); b++) {
+            snapshot.bus_mixes[b].resize(MAX_CHUNK_LENGTH, bus_channels(*snapshot.buses.buses[b].bus));
+            mix_channels = std::max(mix_channels, snapshot.bus_mixes[b].channels());
+        }
+
+        // Likewise, the worker buffers are sized for a full chunk of the widest source and filter.
+        // Buffers only reallocate when they grow, so the capacity is what matters.
+        Mixer &mixer = snapshot.mixer;
+        unsigned scratch_channels = channels;
+        for (const Source &source : _sources) {
+            unsigned source_channels = source.channels();
+            if (!source._buffer.has_value()) {
+                const Resampler &resampler = find_resampler(_resamplers, source);
+                unsigned window = std::ceil(MAX_CHUNK_LENGTH * resampler.ratio()) + 2 * resampler.radius() + 3;
+                mixer.window.resize(window, source_channels);
+            }
+            scratch_channels = std::max(scratch_channels, source_channels);
+            if (source._filter.has_value()) {
+                const Filter &filter = source._filter.value();
+                scratch_channels = std::max(scratch_channels, filter.output_channels(source_channels));
+            }
+        }
+        mixer.scratch.resize(MAX_CHUNK_LENGTH, scratch_channels);
+        mixer.remixed.resize(MAX_CHUNK_LENGTH, mix_channels);
+        mixer.composite.resize(MAX_CHUNK_LENGTH, channels);
+        _snapshots.publish();
+    }
+
     Listener &Jukebox::listener() { return _listener; }
 
+    VoiceManager &Jukebox::voices() { return _voices; }
+
     const std::vector<Device> &Jukebox::devices() {
         PaError err;
 
@@ -186,7 +642,7 @@ namespace Dynamo::Sound {
                             paFramesPerBufferUnspecified,
                             paNoFlag,
                             input_callback,
-                            &_input_state);
+                            this);
         if (err != paNoError) {
             Log::error("Could not open PortAudio input stream: {}", Pa_GetErrorText(err));
         }
@@ -228,7 +684,7 @@ namespace Dynamo::Sound {
                             paFramesPerBufferUnspecified,
                             paNoFlag,
                             output_callback,
-                            &_output_state);
+                            this);
         if (err != paNoError) {
             Log::error("Could not open PortAudio output stream: {}", Pa_GetErrorText(err));
         }
@@ -245,79 +701,566 @@ namespace Dynamo::Sound {
         }
 
         // Update internal state
-        _output_state.sample_rate = info->sampleRate;
-        _output_state.channels = device.output_channels;
-        _composite.resize(MAX_CHUNK_LENGTH, device.output_channels);
+        configure_output(device.output_channels, info->sampleRate);
+    }
+
+    void Jukebox::configure_output(unsigned channels, double sample_rate) {
+        _output_state.sample_rate = sample_rate;
+        _output_state.channels = channels;
+        _resamplers.clear();
+        _interleaved.resize(MAX_CHUNK_LENGTH * channels);
+        _pending.resize(MAX_CHUNK_LENGTH * channels);
+        _pending_frames = 0;
+        for (Mixer &mixer : _mixers) {
+            mixer.composite.resize(MAX_CHUNK_LENGTH, channels);
+            mixer.remixed.resize(MAX_CHUNK_LENGTH, channels);
+        }
+        update_target_length();
+    }
+
+    void Jukebox::update_target_length() {
+        unsigned channels = _output_state.channels;
+        unsigned frames = std::round(_latency * _output_state.sample_rate);
+        frames = std::min(std::max(frames, 2 * MAX_CHUNK_LENGTH), BUFFER_SIZE / channels);
+        _output_state.target_length.store(frames * channels, std::memory_order_relaxed);
     }
 
+    unsigned Jukebox::get_channels() const { return _output_state.channels; }
+
+    double Jukebox::get_sample_rate() const { return _output_state.sample_rate; }
+
     void Jukebox::set_volume(float volume) { _volume = std::clamp(volume, 0.0f, 1.0f); }
 
     float Jukebox::get_volume() const { return _volume; }
 
+    void Jukebox::set_latency(double latency) {
+        _latency = latency;
+        update_target_length();
+    }
+
+    double Jukebox::get_latency() const { return _latency; }
+
     bool Jukebox::is_playing() { return _output_stream != nullptr && Pa_IsStreamActive(_output_stream); }
 
+    bool Jukebox::is_offline() const { return _output_stream == nullptr; }
+
     bool Jukebox::is_recording() { return _input_stream != nullptr && Pa_IsStreamActive(_input_stream); }
 
     void Jukebox::play(Source &source) {
-        if (source._playing) return;
+        // A source is only mixed by one Jukebox at a time
+        if (source._jukebox != this) {
+            if (source._jukebox != nullptr) {
+                source._jukebox->detach(source);
+            }
+            source._jukebox = this;
+            _attached.push_back(&source);
+        }
+        if (source._playing.exchange(true)) return;
+        source._generation.fetch_add(1, std::memory_order_release);
 
-        source._playing = true;
-        _sources.emplace_back(source);
+        // The mixer only sees the parameters that have been published
+        if (source._filter.has_value()) {
+            source._filter.value().get().prepare(source, _listener);
+        }
+        source.publish();
+        if (std::find(_submitted.begin(), _submitted.end(), &source) == _submitted.end()) {
+            _submitted.push_back(&source);
+        }
+        push_command({Command::Play, &source});
     }
 
     void Jukebox::pause(Source &source) {
-        if (!source._playing) return;
+        // Paused sources are no longer published, even if they finished before the last commit
+        auto s_it = std::find(_submitted.begin(), _submitted.end(), &source);
+        if (s_it != _submitted.end()) {
+            _submitted.erase(s_it);
+        }
+        if (!source._playing.exchange(false)) return;
+        push_command({Command::Pause, &source});
+    }
 
-        auto d_it = _sources.begin();
-        while (d_it != _sources.end()) {
-            if (&d_it->get() == &source) {
-                _sources.erase(d_it);
-                source._playing = false;
-                break;
+    void Jukebox::detach(Source &source) {
+        pause(source);
+
+        // The game thread owns the sources in real-time mode, so the callback picks up the change from a new snapshot
+        if (is_realtime()) {
+            apply_commands();
+            publish();
+        }
+
+        // Chunks started from here on apply the pause first, so only the chunk being mixed can still use the source.
+        // The fence orders the pause before reading the counter, which release and acquire alone do not.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        unsigned mixing = _mixing.load();
+        if (mixing & 1) {
+            while (_mixing.load() == mixing) {
+                std::this_thread::yield();
+            }
+        }
+
+        // Reports are ignored since the source is no longer playing, but they must be popped while it still exists
+        finish_sources();
+
+        auto a_it = std::find(_attached.begin(), _attached.end(), &source);
+        if (a_it != _attached.end()) {
+            _attached.erase(a_it);
+        }
+        source._jukebox = nullptr;
+    }
+
+    void Jukebox::commit() {
+        finish_sources();
+
+        // Sources that were paused or have finished no longer need to be published
+        auto s_it = std::remove_if(_submitted.begin(), _submitted.end(), [](Source *source) {
+            return !source->is_playing();
+        });
+        _submitted.erase(s_it, _submitted.end());
+
+        // Filters prepare for the new parameters before the mixer can see them
+        for (Source *source : _submitted) {
+            if (source->_filter.has_value()) {
+                source->_filter.value().get().prepare(*source, _listener);
+            }
+        }
+        prepare_buses();
+
+        Parameters &parameters = _parameters.back();
+        parameters.listener = _listener;
+        parameters.volume = _volume;
+        schedule_buses(parameters.buses);
+        _parameters.publish();
+        for (Source *source : _submitted) {
+            source->publish();
+        }
+    }
+
+    void Jukebox::push_command(const Command &command) {
+        while (!_commands.push(command)) {
+            if (is_offline() || is_realtime()) {
+                apply_commands();
             } else {
-                d_it++;
+                std::this_thread::yield();
             }
         }
     }
 
+    void Jukebox::apply_commands() {
+        Command command;
+        while (_commands.pop(&command, 1) == 1) {
+            auto s_it = std::find_if(_sources.begin(), _sources.end(), [&](const SourceRef &source) {
+                return &source.get() == command.source;
+            });
+            switch (command.type) {
+            case Command::Play:
+                if (s_it == _sources.end()) {
+                    _sources.emplace_back(*command.source);
+                }
+                break;
+            case Command::Pause:
+                if (s_it != _sources.end()) {
+                    _sources.erase(s_it);
+                }
+                break;
+            }
+        }
+    }
+
+    void Jukebox::apply_seek(Source &source) {
+        double frame = source._seek.exchange(-1, std::memory_order_acquire);
+        if (frame >= 0) {
+            source._frame = frame;
+        }
+    }
+
+    void Jukebox::add_bus(Bus &bus) {
+        for (Bus &added : _buses) {
+            if (&added == &bus) return;
+        }
+        _buses.emplace_back(bus);
+    }
+
+    void Jukebox::remove_bus(Bus &bus) {
+        auto b_it = std::find_if(_buses.begin(), _buses.end(), [&](const BusRef &added) {
+            return &added.get() == &bus;
+        });
+        if (b_it != _buses.end()) {
+            _buses.erase(b_it);
+        }
+    }
+
     void Jukebox::resume() { Pa_StartStream(_output_stream); }
 
     void Jukebox::pause() { Pa_StopStream(_output_stream); }
 
+    void Jukebox::wait() {
+        unsigned chunk_length = MAX_CHUNK_LENGTH * _output_state.channels;
+        std::chrono::duration<double> timeout(_latency);
+
+        std::unique_lock<std::mutex> lock(_output_state.mutex);
+        _output_state.signal.wait_for(lock, timeout, [&]() {
+            unsigned target_length = _output_state.target_length.load(std::memory_order_relaxed);
+            return !is_realtime() && is_playing() && _output_state.buffer.size() + chunk_length <= target_length;
+        });
+    }
+
+    void Jukebox::set_realtime(bool realtime) {
+        if (realtime) {
+            publish();
+        }
+        _realtime.store(realtime, std::memory_order_release);
+    }
+
+    bool Jukebox::is_realtime() const { return _realtime.load(std::memory_order_relaxed); }
+
     void Jukebox::update() {
-        // Wait for there to be available space in the buffer
-        unsigned min_length = MAX_CHUNK_LENGTH * _output_state.channels;
-        if (_output_state.buffer.remaining() < min_length || !is_playing()) {
+        // Retire finished sources and hand the callback a new snapshot
+        if (is_realtime()) {
+            commit();
+            apply_commands();
+            publish();
+            return;
+        }
+
+        // Offline, render() is the only consumer of the commands
+        if (is_offline()) {
             return;
         }
 
-        // Zero-out the composite waveform
-        _composite.silence();
+        // Commands are still drained while paused so the queue does not fill up
+        if (!is_playing()) {
+            apply_commands();
+            return;
+        }
 
-        // Process chunks and mix onto the composite
-        auto d_it = _sources.begin();
-        while (d_it != _sources.end()) {
-            Source &source = *d_it;
-            if (source._frame >= source._frame_stop) {
-                d_it = _sources.erase(d_it);
-                source._playing = false;
-                source._on_finish();
-            } else {
-                process_source(source);
-                d_it++;
+        // Mix chunks until the target latency is buffered
+        unsigned chunk_length = MAX_CHUNK_LENGTH * _output_state.channels;
+        unsigned target_length = _output_state.target_length.load(std::memory_order_relaxed);
+        while (_output_state.buffer.size() < target_length && _output_state.buffer.remaining() >= chunk_length) {
+            mix();
+        }
+    }
+
+    bool Jukebox::finish_source(Source &source) {
+        // A seek made before the source was played again is applied on the next chunk, so it has not finished
+        unsigned generation = source._generation.load(std::memory_order_acquire);
+        double frame_stop = source._playback.front().frame_stop;
+        if (source._frame < frame_stop || source._seek.load(std::memory_order_relaxed) >= 0) {
+            return false;
+        }
+        if (source._finished == generation) {
+            return true;
+        }
+        if (!_finished.push({&source, generation})) {
+            return false;
+        }
+        source._finished = generation;
+        return true;
+    }
+
+    void Jukebox::retire_sources() {
+        auto d_it = std::remove_if(_sources.begin(), _sources.end(), [&](Source &source) {
+            return finish_source(source);
+        });
+        _sources.erase(d_it, _sources.end());
+    }
+
+    void Jukebox::finish_sources() {
+        Finished finished;
+        while (_finished.pop(&finished, 1) == 1) {
+            Source &source = *finished.source;
+            if (finished.generation != source._generation.load(std::memory_order_relaxed) || !source.is_playing()) {
+                continue;
+            }
+            source._playing = false;
+
+            // The output callback only reports finished sources, the game thread owns the list in real-time mode
+            if (is_realtime()) {
+                auto s_it = std::find_if(_sources.begin(), _sources.end(), [&](const SourceRef &playing) {
+                    return &playing.get() == &source;
+                });
+                if (s_it != _sources.end()) {
+                    _sources.erase(s_it);
+                }
+            }
+            source._on_finish();
+        }
+    }
+
+    unsigned Jukebox::find_group(unsigned group) {
+        while (_group_parents[group] != group) {
+            _group_parents[group] = _group_parents[_group_parents[group]];
+            group = _group_parents[group];
+        }
+        return group;
+    }
+
+    unsigned Jukebox::group_voices() {
+        const std::vector<Source *> &voices = _voices.real_voices();
+        _filter_groups.clear();
+        _group_parents.clear();
+
+        // Each source starts in its own group, which is merged into the earliest group that reaches any of its
+        // filters, so the result only depends on the order of the voices
+        for (unsigned v = 0; v < voices.size(); v++) {
+            Source &source = *voices[v];
+            _group_parents.push_back(v);
+            if (!source._filter.has_value()) {
+                continue;
+            }
+            _filters.clear();
+            source._filter.value().get().collect(_filters);
+            for (Filter *filter : _filters) {
+                auto it = _filter_groups.find(filter);
+                if (it == _filter_groups.end()) {
+                    _filter_groups.emplace(filter, v);
+                    continue;
+                }
+                unsigned a = find_group(it->second);
+                unsigned b = find_group(v);
+                _group_parents[std::max(a, b)] = std::min(a, b);
+            }
+        }
+
+        // Number the merged groups in order of their first source
+        unsigned group_count = 0;
+        _group_indices.assign(voices.size(), voices.size());
+        for (unsigned v = 0; v < voices.size(); v++) {
+            unsigned root = find_group(v);
+            if (_group_indices[root] == voices.size()) {
+                if (_groups.size() == group_count) {
+                    _groups.emplace_back();
+                }
+                _groups[group_count].clear();
+                _group_indices[root] = group_count++;
+            }
+            _groups[_group_indices[root]].push_back(voices[v]);
+        }
+        return group_count;
+    }
+
+    void Jukebox::mix_groups(unsigned group_begin, unsigned group_end, unsigned frame_count, Mixer &mixer) {
+        Parameters &parameters = _parameters.front();
+        mixer.composite.silence();
+        for (Buffer &bus_mix : mixer.buses) {
+            bus_mix.silence();
+        }
+        for (unsigned g = group_begin; g < group_end; g++) {
+            for (Source *source : _groups[g]) {
+                process_source(*source,
+                               find_resampler(_resamplers, *source),
+                               parameters.listener,
+                               parameters.volume,
+                               frame_count,
+                               mixer,
+                               parameters.buses,
+                               mixer.buses);
+            }
+        }
+    }
+
+    void Jukebox::mix_partitions(unsigned partition_begin,
+                                 unsigned partition_end,
+                                 unsigned partitions,
+                                 unsigned group_count,
+                                 unsigned frame_count) {
+        for (unsigned p = partition_begin; p < partition_end; p++) {
+            unsigned group_begin = (p * group_count) / partitions;
+            unsigned group_end = ((p + 1) * group_count) / partitions;
+            mix_groups(group_begin, group_end, frame_count, _mixers[p]);
+        }
+    }
+
+    void Jukebox::record_chunk(std::chrono::steady_clock::time_point start,
+                               unsigned frame_count,
+                               Mixer *mixers,
+                               unsigned count) {
+        uint64_t mix_time = lap(start);
+        float load = (mix_time * 1e-9) * _output_state.sample_rate / frame_count;
+        _counters.chunks.fetch_add(1, std::memory_order_relaxed);
+        if (load > 1) {
+            _counters.late_chunks.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Chunks are only recorded by the thread that mixes, so the maxima need not be compared atomically
+        _counters.mix_time.fetch_add(mix_time, std::memory_order_relaxed);
+        if (mix_time > _counters.max_mix_time.load(std::memory_order_relaxed)) {
+            _counters.max_mix_time.store(mix_time, std::memory_order_relaxed);
+        }
+        if (load > _counters.max_load.load(std::memory_order_relaxed)) {
+            _counters.max_load.store(load, std::memory_order_relaxed);
+        }
+
+        for (unsigned m = 0; m < count; m++) {
+            Mixer &mixer = mixers[m];
+            _counters.voice_chunks.fetch_add(mixer.voice_chunks, std::memory_order_relaxed);
+            _counters.resample_time.fetch_add(mixer.resample_time, std::memory_order_relaxed);
+            _counters.filter_time.fetch_add(mixer.filter_time, std::memory_order_relaxed);
+            _counters.remix_time.fetch_add(mixer.remix_time, std::memory_order_relaxed);
+            mixer.voice_chunks = 0;
+            mixer.resample_time = 0;
+            mixer.filter_time = 0;
+            mixer.remix_time = 0;
+        }
+    }
+
+    void Jukebox::mix_chunk(unsigned frame_count) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        _mixing.fetch_add(1);
+
+        // Pairs with the fence in detach(), so either the pause is seen here or the chunk is waited for there
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Pick up the latest commands and parameters from the game thread
+        apply_commands();
+        _parameters.acquire();
+        Parameters &parameters = _parameters.front();
+        for (Source &source : _sources) {
+            source._playback.acquire();
+            apply_seek(source);
+        }
+        retire_sources();
+        prepare_resamplers(_resamplers, _sources);
+
+        // Only the selected voices are processed, the rest just keep time
+        _voices.update(_sources, parameters.listener, parameters.volume);
+        _counters.real_voices.store(_voices.real_voices().size(), std::memory_order_relaxed);
+        _counters.virtual_voices.store(_voices.virtual_voices().size(), std::memory_order_relaxed);
+        for (Source *source : _voices.virtual_voices()) {
+            advance_source(*source, find_resampler(_resamplers, *source), frame_count);
+        }
+
+        // Each worker mixes the sources routed into a bus onto its own partial mix of the bus
+        BusSchedule &buses = parameters.buses;
+        for (Mixer &mixer : _mixers) {
+            mixer.buses.resize(buses.buses.size());
+            for (unsigned b = 0; b < mixer.buses.size(); b++) {
+                mixer.buses[b].resize(MAX_CHUNK_LENGTH, bus_channels(*buses.buses[b].bus));
+            }
+        }
+
+        // Sources that share a filter must be mixed into the same partition, since filters keep state
+        unsigned group_count = group_voices();
+
+        // Split the groups into contiguous partitions so each partial mix always
+        // has the same sources in the same order, then share the partitions
+        // between the threads. Only the latter depends on the thread count.
+        unsigned partitions = std::max(std::min(MIX_PARTITIONS, group_count), 1U);
+        unsigned workers = std::min(_threads, partitions);
+        _jobs.clear();
+        for (unsigned w = 1; w < workers; w++) {
+            unsigned partition_begin = (w * partitions) / workers;
+            unsigned partition_end = ((w + 1) * partitions) / workers;
+            _jobs.push_back(_pool.submit([&, partition_begin, partition_end]() {
+                mix_partitions(partition_begin, partition_end, partitions, group_count, frame_count);
+            }));
+        }
+        mix_partitions(0, partitions / workers, partitions, group_count, frame_count);
+        for (std::future<void> &job : _jobs) {
+            job.get();
+        }
+
+        // Reduce the partial mixes pairwise in a fixed order
+        for (unsigned stride = 1; stride < partitions; stride *= 2) {
+            for (unsigned p = 0; p + stride < partitions; p += 2 * stride) {
+                Buffer &dst = _mixers[p].composite;
+                const Buffer &src = _mixers[p + stride].composite;
+                for (unsigned c = 0; c < dst.channels(); c++) {
+                    Vectorize::vadd(src[c], dst[c], dst[c], dst.frames());
+                }
+                for (unsigned b = 0; b < buses.buses.size(); b++) {
+                    Buffer &bus_dst = _mixers[p].buses[b];
+                    const Buffer &bus_src = _mixers[p + stride].buses[b];
+                    for (unsigned c = 0; c < bus_dst.channels(); c++) {
+                        Vectorize::vadd(bus_src[c], bus_dst[c], bus_dst[c], bus_dst.frames());
+                    }
+                }
             }
         }
 
+        // Run each bus once on the sum of its inputs
+        mix_buses(buses,
+                  _mixers[0].buses,
+                  parameters.listener,
+                  parameters.volume,
+                  frame_count,
+                  _mixers[0].composite,
+                  true);
+
         // Clamp channels
-        for (unsigned c = 0; c < _composite.channels(); c++) {
-            Vectorize::vclamp(_composite[c], -1, 1, _composite[c], _composite.frames());
+        Buffer &composite_buffer = _mixers[0].composite;
+        for (unsigned c = 0; c < composite_buffer.channels(); c++) {
+            Vectorize::vclamp(composite_buffer[c], -1, 1, composite_buffer[c], frame_count);
         }
+        record_chunk(start, frame_count, _mixers.data(), partitions);
+        _mixing.fetch_add(1);
+    }
+
+    void Jukebox::mix() {
+        mix_chunk(MAX_CHUNK_LENGTH);
 
-        // Interleave the composite and write to the ring buffer
-        for (unsigned f = 0; f < _composite.frames(); f++) {
-            for (unsigned c = 0; c < _composite.channels(); c++) {
-                _output_state.buffer.write(_composite[c][f]);
+        // Interleave the composite, then copy it into the ring buffer, which may wrap in the middle of a frame
+        const Buffer &composite = _mixers[0].composite;
+        unsigned frames = composite.frames();
+        unsigned channels = composite.channels();
+        Vectorize::vinterleave(composite.data(), frames, channels, _interleaved.data(), frames);
+        _output_state.buffer.write(_interleaved.data(), frames * channels);
+    }
+
+    void Jukebox::render(unsigned frame_count, Buffer &dst) {
+        DYN_ASSERT(is_offline());
+        dst.resize(frame_count, _output_state.channels);
+        commit();
+
+        const Buffer &composite = _mixers[0].composite;
+        for (unsigned offset = 0; offset < frame_count; offset += MAX_CHUNK_LENGTH) {
+            unsigned frames = std::min(frame_count - offset, MAX_CHUNK_LENGTH);
+            mix_chunk(frames);
+            for (unsigned c = 0; c < dst.channels(); c++) {
+                std::copy(composite[c], composite[c] + frames, dst[c] + offset);
             }
         }
+
+        // Sources that finished while rendering are stopped before returning
+        finish_sources();
+    }
+
+    Stats Jukebox::stats() const {
+        Stats stats;
+        stats.output_underflows = _counters.output_underflows.load(std::memory_order_relaxed);
+        stats.output_overflows = _counters.output_overflows.load(std::memory_order_relaxed);
+        stats.input_underflows = _counters.input_underflows.load(std::memory_order_relaxed);
+        stats.input_overflows = _counters.input_overflows.load(std::memory_order_relaxed);
+        stats.dropped_frames = _counters.dropped_frames.load(std::memory_order_relaxed);
+        stats.buffered_frames = _output_state.buffer.size() / _output_state.channels;
+        stats.chunks = _counters.chunks.load(std::memory_order_relaxed);
+        stats.late_chunks = _counters.late_chunks.load(std::memory_order_relaxed);
+        stats.mix_time = _counters.mix_time.load(std::memory_order_relaxed) * 1e-9;
+        stats.max_mix_time = _counters.max_mix_time.load(std::memory_order_relaxed) * 1e-9;
+        stats.max_load = _counters.max_load.load(std::memory_order_relaxed);
+        stats.voice_chunks = _counters.voice_chunks.load(std::memory_order_relaxed);
+        stats.resample_time = _counters.resample_time.load(std::memory_order_relaxed) * 1e-9;
+        stats.filter_time = _counters.filter_time.load(std::memory_order_relaxed) * 1e-9;
+        stats.remix_time = _counters.remix_time.load(std::memory_order_relaxed) * 1e-9;
+        stats.real_voices = _counters.real_voices.load(std::memory_order_relaxed);
+        stats.virtual_voices = _counters.virtual_voices.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void Jukebox::reset_stats() {
+        _counters.output_underflows.store(0, std::memory_order_relaxed);
+        _counters.output_overflows.store(0, std::memory_order_relaxed);
+        _counters.input_underflows.store(0, std::memory_order_relaxed);
+        _counters.input_overflows.store(0, std::memory_order_relaxed);
+        _counters.dropped_frames.store(0, std::memory_order_relaxed);
+        _counters.chunks.store(0, std::memory_order_relaxed);
+        _counters.late_chunks.store(0, std::memory_order_relaxed);
+        _counters.mix_time.store(0, std::memory_order_relaxed);
+        _counters.max_mix_time.store(0, std::memory_order_relaxed);
+        _counters.max_load.store(0, std::memory_order_relaxed);
+        _counters.voice_chunks.store(0, std::memory_order_relaxed);
+        _counters.resample_time.store(0, std::memory_order_relaxed);
+        _counters.filter_time.store(0, std::memory_order_relaxed);
+        _counters.remix_time.store(0, std::memory_order_relaxed);
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
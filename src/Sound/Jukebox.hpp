@@ -1,15 +1,30 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 #include <portaudio.h>
 
+#include <Utils/ConcurrentQueue.hpp>
+#include <Utils/FlatMap.hpp>
 #include <Utils/RingBuffer.hpp>
+#include <Utils/ThreadPool.hpp>
+#include <Utils/TripleBuffer.hpp>
 
 #include <Sound/Buffer.hpp>
+#include <Sound/Bus.hpp>
+#include <Sound/DSP/Resample.hpp>
 #include <Sound/Device.hpp>
 #include <Sound/Listener.hpp>
 #include <Sound/Source.hpp>
+#include <Sound/Stats.hpp>
+#include <Sound/VoiceManager.hpp>
 
 namespace Dynamo::Sound {
     /**
@@ -30,6 +45,27 @@ namespace Dynamo::Sound {
      */
     static constexpr unsigned BUFFER_SIZE = MAX_CHUNK_LENGTH * 64;
 
+    /**
+     * @brief Default target latency of the output buffer in seconds.
+     *
+     */
+    static constexpr double DEFAULT_LATENCY = 0.05;
+
+    /**
+     * @brief Maximum number of pending commands to the mixer.
+     *
+     */
+    static constexpr unsigned COMMAND_QUEUE_SIZE = 1 << 10;
+
+    /**
+     * @brief Number of partial mixes the sources are split into.
+     *
+     * The split and the order the partial mixes are summed in only depend
+     * on this, so the output is the same on any number of threads.
+     *
+     */
+    static constexpr unsigned MIX_PARTITIONS = 8;
+
     /**
      * @brief Audio engine supporting sound spatialization.
      *
@@ -39,14 +75,184 @@ namespace Dynamo::Sound {
         PaStream *_output_stream;
 
         float _volume;
+        double _latency;
+
+        /**
+         * @brief Resamplers from each source sample rate to the device sample rate.
+         *
+         */
+        using ResamplerMap = FlatMap<unsigned, std::shared_ptr<const Resampler>>;
+        ResamplerMap _resamplers;
+
+        /**
+         * @brief Scratch buffers and partial mix of a partition.
+         *
+         */
+        struct Mixer {
+            Buffer window;
+            Buffer scratch;
+            Buffer remixed;
+            Buffer composite;
+            std::vector<Buffer> buses;
+
+            // Time spent in each stage of the sources processed since the
+            // last chunk, in nanoseconds
+            unsigned voice_chunks = 0;
+            uint64_t resample_time = 0;
+            uint64_t filter_time = 0;
+            uint64_t remix_time = 0;
+        };
+        unsigned _threads;
+        std::vector<Mixer> _mixers;
+        ThreadPool _pool;
+
+        /**
+         * @brief Interleaved chunk to be written to the output buffer.
+         *
+         */
+        std::vector<WaveSample> _interleaved;
+
+        /**
+         * @brief Interleaved chunk mixed by the output callback in real-time
+         * mode, and the frames of it that are left to play.
+         *
+         * Filters like the convolvers process whole chunks, so the callback
+         * always mixes full chunks and plays the rest of the last one on its
+         * next call.
+         *
+         */
+        std::vector<WaveSample> _pending;
+        unsigned _pending_offset;
+        unsigned _pending_frames;
+
+        /**
+         * @brief Sources split into groups that share no filters.
+         *
+         * Groups are merged with a union-find over every filter reachable
+         * from each source, so the filters inside a FilterSequence are
+         * never applied on two threads at once. A group is always mixed
+         * whole into one partition, and the groups only depend on the order
+         * of the voices, so neither does the sum of the partitions.
+         *
+         */
+        std::vector<std::vector<Source *>> _groups;
+        FlatMap<Filter *, unsigned> _filter_groups;
+        std::vector<unsigned> _group_parents;
+        std::vector<unsigned> _group_indices;
+        std::vector<Filter *> _filters;
+        std::vector<std::future<void>> _jobs;
+
+        /**
+         * @brief Routing of a bus as last committed, with its mixing buffers.
+         *
+         * The mixer only reads these copies, so the game thread can change
+         * the bus while it is being processed.
+         *
+         */
+        struct BusNode {
+            const Bus *bus;
+            std::optional<FilterRef> filter;
+            const Source *source;
+            float volume;
+
+            // Index of the bus this one feeds, or the number of buses if it feeds the master
+            unsigned output;
+            Buffer input;
+            Buffer mix;
+        };
+
+        /**
+         * @brief Processing order of the buses.
+         *
+         * Buses are sorted by their distance from the master, deepest first,
+         * so each level only takes input from the level before it and the
+         * buses within a level can be processed in parallel.
+         *
+         */
+        struct BusSchedule {
+            std::vector<BusNode> buses;
+            std::vector<unsigned> levels;
+            FlatMap<const Bus *, unsigned> indices;
+        };
+        std::vector<std::pair<unsigned, Bus *>> _bus_order;
+
+        /**
+         * @brief Request from the game thread, applied by the mixer at the start of a chunk.
+         *
+         */
+        struct Command {
+            enum Type : unsigned {
+                Play,
+                Pause,
+            };
+            Type type;
+            Source *source;
+        };
+        ConcurrentQueue<Command, COMMAND_QUEUE_SIZE> _commands;
+
+        /**
+         * @brief Report from the mixer that a source reached its stop time,
+         * handled by the game thread on its next commit.
+         *
+         */
+        struct Finished {
+            Source *source;
+            unsigned generation;
+        };
+        ConcurrentQueue<Finished, COMMAND_QUEUE_SIZE> _finished;
+
+        /**
+         * @brief Listener, master volume, and bus routing as last committed by the game thread.
+         *
+         */
+        struct Parameters {
+            Listener listener;
+            float volume;
+            BusSchedule buses;
+        };
+        TripleBuffer<Parameters> _parameters;
+
+        /**
+         * @brief Incremented when the mixer starts and finishes a chunk, so
+         * it is odd while a chunk is being mixed.
+         *
+         */
+        std::atomic<unsigned> _mixing;
+
+        /**
+         * @brief Sources that have been played, which detach when they are destroyed.
+         *
+         */
+        std::vector<Source *> _attached;
 
-        Buffer _scratch;
-        Buffer _remixed;
-        Buffer _composite;
+        friend class Source;
 
         Listener _listener;
+        std::vector<Source *> _submitted;
         std::vector<SourceRef> _sources;
+        std::vector<BusRef> _buses;
         std::vector<Device> _devices;
+        VoiceManager _voices;
+
+        /**
+         * @brief Mixer parameters read by the output callback in real-time mode.
+         *
+         * The scratch buffers are sized by the game thread for the sources
+         * of the snapshot, so the callback does not allocate.
+         *
+         */
+        struct MixSnapshot {
+            Listener listener;
+            float volume;
+            std::vector<SourceRef> sources;
+            VoiceManager voices;
+            ResamplerMap resamplers;
+            BusSchedule buses;
+            std::vector<Buffer> bus_mixes;
+            Mixer mixer;
+        };
+        TripleBuffer<MixSnapshot> _snapshots;
+        std::atomic_bool _realtime;
 
         /**
          * @brief Internal state shared with the PortAudio callback.
@@ -56,10 +262,41 @@ namespace Dynamo::Sound {
             RingBuffer<WaveSample, BUFFER_SIZE> buffer;
             unsigned channels;
             double sample_rate;
+
+            // Number of buffered samples to maintain and the wake signal
+            // raised by the callback when the buffer drains below it
+            std::atomic<unsigned> target_length;
+            std::condition_variable signal;
+            std::mutex mutex;
         };
         PaState _input_state;
         PaState _output_state;
 
+        /**
+         * @brief Performance counters, written by the mixer and the PortAudio
+         * callbacks. Times are in nanoseconds.
+         *
+         */
+        struct Counters {
+            std::atomic<unsigned> output_underflows{0};
+            std::atomic<unsigned> output_overflows{0};
+            std::atomic<unsigned> input_underflows{0};
+            std::atomic<unsigned> input_overflows{0};
+            std::atomic<unsigned> dropped_frames{0};
+            std::atomic<unsigned> chunks{0};
+            std::atomic<unsigned> late_chunks{0};
+            std::atomic<uint64_t> mix_time{0};
+            std::atomic<uint64_t> max_mix_time{0};
+            std::atomic<float> max_load{0};
+            std::atomic<unsigned> voice_chunks{0};
+            std::atomic<uint64_t> resample_time{0};
+            std::atomic<uint64_t> filter_time{0};
+            std::atomic<uint64_t> remix_time{0};
+            std::atomic<unsigned> real_voices{0};
+            std::atomic<unsigned> virtual_voices{0};
+        };
+        Counters _counters;
+
         /**
          * @brief Callback for pulling data from the input device.
          *
@@ -99,16 +336,302 @@ namespace Dynamo::Sound {
         /**
          * @brief Process a sound source.
          *
+         * @param source      Sound source
+         * @param resampler   Resampler from the source to the device sample rate
+         * @param listener    Listener
+         * @param volume      Master volume
+         * @param frame_count Maximum number of frames (up to MAX_CHUNK_LENGTH)
+         * @param mixer       Worker buffers to mix into
+         * @param schedule    Bus schedule
+         * @param bus_mixes   Partial mixes of the sources routed into each bus
+         */
+        void process_source(Source &source,
+                            const Resampler &resampler,
+                            const Listener &listener,
+                            float volume,
+                            unsigned frame_count,
+                            Mixer &mixer,
+                            const BusSchedule &schedule,
+                            std::vector<Buffer> &bus_mixes);
+
+        /**
+         * @brief Get the number of channels the inputs of a bus are summed in.
+         *
+         * @param bus
+         * @return unsigned
+         */
+        unsigned bus_channels(const Bus &bus) const;
+
+        /**
+         * @brief Sort the added buses into levels by their distance from the master.
+         *
+         * Buses that are routed into a bus that is not added are left out.
+         * This runs on the game thread, which also sizes the bus buffers.
+         *
+         * @param schedule
+         */
+        void schedule_buses(BusSchedule &schedule);
+
+        /**
+         * @brief Place the sources of the bus filters at the listener and
+         * prepare the filters for them.
+         *
+         */
+        void prepare_buses();
+
+        /**
+         * @brief Sum the inputs of a bus and apply its filter.
+         *
+         * @param schedule    Bus schedule
+         * @param index       Index of the bus in the schedule
+         * @param input_begin First bus of the previous level
+         * @param input_end   One past the last bus of the previous level
+         * @param sources     Partial mix of the sources routed into the bus
+         * @param listener    Listener
+         * @param frame_count Number of frames (up to MAX_CHUNK_LENGTH)
+         */
+        void process_bus(BusSchedule &schedule,
+                         unsigned index,
+                         unsigned input_begin,
+                         unsigned input_end,
+                         const Buffer &sources,
+                         const Listener &listener,
+                         unsigned frame_count);
+
+        /**
+         * @brief Process all buses level by level and mix the ones feeding the
+         * master into the composite.
+         *
+         * @param schedule    Bus schedule
+         * @param bus_mixes   Partial mixes of the sources routed into each bus
+         * @param listener    Listener
+         * @param volume      Master volume
+         * @param frame_count Number of frames (up to MAX_CHUNK_LENGTH)
+         * @param composite   Composite signal
+         * @param parallel    Process the buses of a level on the thread pool
+         */
+        void mix_buses(BusSchedule &schedule,
+                       const std::vector<Buffer> &bus_mixes,
+                       const Listener &listener,
+                       float volume,
+                       unsigned frame_count,
+                       Buffer &composite,
+                       bool parallel);
+
+        /**
+         * @brief Create the missing resamplers for the sample rates of the sources.
+         *
+         * @param resamplers
+         * @param sources
+         */
+        void prepare_resamplers(ResamplerMap &resamplers, const std::vector<SourceRef> &sources);
+
+        /**
+         * @brief Get the prepared resampler for a source.
+         *
+         * @param resamplers
+         * @param source
+         * @return const Resampler&
+         */
+        const Resampler &find_resampler(const ResamplerMap &resamplers, const Source &source) const;
+
+        /**
+         * @brief Get the number of device frames a source will play in a chunk.
+         *
+         * @param source      Sound source
+         * @param resampler   Resampler from the source to the device sample rate
+         * @param frame_count Maximum number of frames (up to MAX_CHUNK_LENGTH)
+         * @return unsigned
+         */
+        unsigned source_frames(const Source &source, const Resampler &resampler, unsigned frame_count) const;
+
+        /**
+         * @brief Advance the playhead of a virtual source without processing it.
+         *
+         * @param source      Sound source
+         * @param resampler   Resampler from the source to the device sample rate
+         * @param frame_count Maximum number of frames (up to MAX_CHUNK_LENGTH)
+         */
+        void advance_source(Source &source, const Resampler &resampler, unsigned frame_count);
+
+        /**
+         * @brief Move the playhead of a source to its last requested seek.
+         *
+         * @param source
+         */
+        void apply_seek(Source &source);
+
+        /**
+         * @brief Queue a command for the mixer.
+         *
+         * If the queue is full, this waits for the mixer to drain it. Offline
+         * and in real-time mode, the calling thread owns the queue, so it
+         * drains it directly.
+         *
+         * @param command
+         */
+        void push_command(const Command &command);
+
+        /**
+         * @brief Stop using a source that is being destroyed.
+         *
+         * This pauses the source, then waits for the chunk being mixed, since
+         * the following chunks start without it. Its pending finish reports
+         * are handled before returning.
+         *
+         * @param source
+         */
+        void detach(Source &source);
+
+        /**
+         * @brief Apply the pending commands to the playing sources.
+         *
+         */
+        void apply_commands();
+
+        /**
+         * @brief Report a source to the game thread if it has reached its stop time.
+         *
+         * Each play of the source is only reported once. This runs on the mixer,
+         * which owns the playhead.
+         *
          * @param source
+         * @return true  The source has finished and was reported
+         * @return false The source is still playing or the report could not be queued
+         */
+        bool finish_source(Source &source);
+
+        /**
+         * @brief Remove sources that have finished playing and report them to the game thread.
+         *
+         */
+        void retire_sources();
+
+        /**
+         * @brief Stop the sources reported finished by the mixer and call their
+         * finish handlers.
+         *
+         * This runs on the game thread. Reports from before a source was
+         * paused or played again are ignored.
+         *
+         */
+        void finish_sources();
+
+        /**
+         * @brief Add the time spent mixing a chunk and the per-source times
+         * of the mixers to the counters, then clear the mixers' times.
+         *
+         * @param start       Time at which the chunk started mixing
+         * @param frame_count Number of frames in the chunk
+         * @param mixers      Mixers that mixed the chunk
+         * @param count       Number of mixers
+         */
+        void record_chunk(std::chrono::steady_clock::time_point start,
+                          unsigned frame_count,
+                          Mixer *mixers,
+                          unsigned count);
+
+        /**
+         * @brief Find the group a source group was merged into.
+         *
+         * @param group
+         * @return unsigned
+         */
+        unsigned find_group(unsigned group);
+
+        /**
+         * @brief Split the real voices into groups that share no filters.
+         *
+         * @return unsigned Number of groups
+         */
+        unsigned group_voices();
+
+        /**
+         * @brief Mix a range of source groups into a partition's composite.
+         *
+         * @param group_begin First group
+         * @param group_end   One past the last group
+         * @param frame_count Maximum number of frames (up to MAX_CHUNK_LENGTH)
+         * @param mixer       Partition buffers to mix into
+         */
+        void mix_groups(unsigned group_begin, unsigned group_end, unsigned frame_count, Mixer &mixer);
+
+        /**
+         * @brief Mix a range of partitions on the calling thread.
+         *
+         * @param partition_begin First partition
+         * @param partition_end   One past the last partition
+         * @param partitions      Number of partitions the groups are split into
+         * @param group_count     Number of groups
+         * @param frame_count     Maximum number of frames (up to MAX_CHUNK_LENGTH)
+         */
+        void mix_partitions(unsigned partition_begin,
+                            unsigned partition_end,
+                            unsigned partitions,
+                            unsigned group_count,
+                            unsigned frame_count);
+
+        /**
+         * @brief Publish the current sources and parameters to the output callback.
+         *
+         * This also sizes the scratch buffers of the snapshot for its sources and buses.
+         *
          */
-        void process_source(Source &source);
+        void publish();
+
+        /**
+         * @brief Mix a chunk of all sources into the composite of the first partition.
+         *
+         * Sources are split into at most MIX_PARTITIONS partial mixes, which
+         * the threads share, and summed pairwise in a fixed order, so the
+         * result depends neither on thread scheduling nor on the number of
+         * threads.
+         *
+         * @param frame_count Number of frames (up to MAX_CHUNK_LENGTH)
+         */
+        void mix_chunk(unsigned frame_count);
+
+        /**
+         * @brief Mix a single chunk of all sources into the output buffer.
+         *
+         */
+        void mix();
+
+        /**
+         * @brief Set the output format and size the mixing buffers for it.
+         *
+         * @param channels
+         * @param sample_rate
+         */
+        void configure_output(unsigned channels, double sample_rate);
+
+        /**
+         * @brief Compute the number of samples to buffer from the target latency.
+         *
+         */
+        void update_target_length();
 
       public:
         /**
-         * @brief Construct a new Jukebox object.
+         * @brief Construct a new Jukebox object on the default devices.
+         *
+         * If there is no output device, this falls back to rendering
+         * offline in stereo at the standard sample rate.
          *
          */
         Jukebox();
+
+        /**
+         * @brief Construct an offline Jukebox that is not attached to any device.
+         *
+         * Audio is only mixed when requested with render(), as fast as
+         * possible, until an output device is set.
+         *
+         * @param channels    Number of output channels
+         * @param sample_rate Output sample rate
+         * @param threads     Number of threads that mix sources, or 0 for the hardware concurrency
+         */
+        Jukebox(unsigned channels, double sample_rate, unsigned threads = 0);
         ~Jukebox();
 
         /**
@@ -118,6 +641,17 @@ namespace Dynamo::Sound {
          */
         Listener &listener();
 
+        /**
+         * @brief Get the voice manager, which limits the sources processed
+         * per chunk to the most audible ones.
+         *
+         * In real-time mode, the output callback selects the voices with a
+         * copy of its settings.
+         *
+         * @return VoiceManager&
+         */
+        VoiceManager &voices();
+
         /**
          * @brief Get all available sound devices.
          *
@@ -143,6 +677,20 @@ namespace Dynamo::Sound {
          */
         void set_output(const Device &device);
 
+        /**
+         * @brief Get the number of output channels.
+         *
+         * @return unsigned
+         */
+        unsigned get_channels() const;
+
+        /**
+         * @brief Get the output sample rate.
+         *
+         * @return double
+         */
+        double get_sample_rate() const;
+
         /**
          * @brief Set the master volume.
          *
@@ -157,6 +705,24 @@ namespace Dynamo::Sound {
          */
         float get_volume() const;
 
+        /**
+         * @brief Set the target output latency in seconds.
+         *
+         * This is the amount of audio that is kept mixed ahead of the
+         * output device. It is clamped to at least two chunks and at most
+         * the capacity of the output buffer.
+         *
+         * @param latency
+         */
+        void set_latency(double latency);
+
+        /**
+         * @brief Get the target output latency in seconds.
+         *
+         * @return double
+         */
+        double get_latency() const;
+
         /**
          * @brief Is the output device playing?
          *
@@ -165,6 +731,14 @@ namespace Dynamo::Sound {
          */
         bool is_playing();
 
+        /**
+         * @brief Is the Jukebox rendering without an output device?
+         *
+         * @return true
+         * @return false
+         */
+        bool is_offline() const;
+
         /**
          * @brief Is the input device listening?
          *
@@ -176,19 +750,56 @@ namespace Dynamo::Sound {
         /**
          * @brief Play a sound source.
          *
-         * @param sound    Sound
-         * @param material Playback properties
-         * @param filters  Filter
+         * The source is queued for the mixer and starts playing at its next
+         * chunk. This is lock-free, so it can be called while another thread
+         * is mixing.
+         *
+         * @param source
          */
         void play(Source &source);
 
         /**
          * @brief Pause a sound source.
          *
+         * The source is queued for the mixer and stops playing at its next chunk.
+         *
          * @param source
          */
         void pause(Source &source);
 
+        /**
+         * @brief Publish the listener, master volume, and the parameters of
+         * the playing sources to the mixer.
+         *
+         * This should be called once per frame on the thread that plays
+         * sources, after updating them. Changes made in between are not heard.
+         * Sources that have reached their stop time are marked as not playing
+         * and their finish handlers are called here, and the filters of the
+         * playing sources are prepared for their new parameters. Changes to
+         * the routing of sources and buses also take effect here.
+         *
+         */
+        void commit();
+
+        /**
+         * @brief Add a submix bus to be processed.
+         *
+         * The bus is processed from the next commit.
+         *
+         * @param bus
+         */
+        void add_bus(Bus &bus);
+
+        /**
+         * @brief Remove a submix bus.
+         *
+         * Sources and buses routed into it are not heard until it is added
+         * again. The bus is no longer processed from the next commit.
+         *
+         * @param bus
+         */
+        void remove_bus(Bus &bus);
+
         /**
          * @brief Resume playback.
          *
@@ -201,11 +812,100 @@ namespace Dynamo::Sound {
          */
         void pause();
 
+        /**
+         * @brief Enable or disable real-time mode.
+         *
+         * In real-time mode, the output callback mixes exactly the frames the
+         * device requests instead of reading pre-mixed audio from the ring buffer,
+         * so the only latency is that of the device itself. update() must then be
+         * called on the same thread as play() and pause() to publish changes to
+         * the callback, and the voices are selected on the callback.
+         *
+         * This should be set before any sources are played.
+         *
+         * @param realtime
+         */
+        void set_realtime(bool realtime);
+
+        /**
+         * @brief Is real-time mode enabled?
+         *
+         * @return true
+         * @return false
+         */
+        bool is_realtime() const;
+
+        /**
+         * @brief Block until the output device has consumed enough of the
+         * buffered audio for another chunk to be mixed.
+         *
+         * This returns after at most the target latency has elapsed, even
+         * if the output device is not playing.
+         *
+         */
+        void wait();
+
         /**
          * @brief Update Jukebox's internal state and process all sources
          * to be written into the output buffer.
          *
+         * Chunks are mixed until the target latency is buffered or the
+         * output buffer is full. In real-time mode, this commits the current
+         * parameters, stops the sources the callback reported finished, and
+         * publishes the current state to the output callback.
+         *
+         * Offline, this does nothing, since render() mixes and drains the
+         * commands on the thread that plays sources.
+         *
          */
         void update();
+
+        /**
+         * @brief Mix the next frames of all playing sources into a buffer.
+         *
+         * This is only available offline. The current parameters are committed
+         * first. The destination is resized to the number of frames and output
+         * channels, and the result only depends on the sources and the calls
+         * made, not on timing.
+         *
+         * Exactly the requested frames are mixed, so that commands take effect
+         * between calls. Filters that process whole chunks, like the
+         * convolvers, need frame counts that are multiples of
+         * MAX_CHUNK_LENGTH.
+         *
+         * @param frame_count Number of frames to mix
+         * @param dst         Destination buffer
+         */
+        void render(unsigned frame_count, Buffer &dst);
+
+        /**
+         * @brief Mix the latest snapshot directly into an interleaved device buffer.
+         *
+         * This is what the output callback runs in real-time mode, and can be
+         * called instead from another audio backend. It must not allocate,
+         * lock, or log. Any number of frames can be requested, chunks are
+         * always mixed whole and the frames that did not fit are played by
+         * the next call.
+         *
+         * @param dst         Device buffer
+         * @param frame_count Frames to write
+         */
+        void render(WaveSample *dst, unsigned frame_count);
+
+        /**
+         * @brief Get the performance counters.
+         *
+         * This only reads atomic counters, so it is cheap enough to call
+         * every frame from any thread.
+         *
+         * @return Stats
+         */
+        Stats stats() const;
+
+        /**
+         * @brief Reset the performance counters.
+         *
+         */
+        void reset_stats();
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
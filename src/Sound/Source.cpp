@@ -1,33 +1,118 @@
 #include <Sound/Buffer.hpp>
+#include <Sound/Jukebox.hpp>
 #include <Sound/Source.hpp>
 #include <algorithm>
 
 namespace Dynamo::Sound {
     Source::Source(Buffer &buffer, std::optional<FilterRef> filter) :
-        _buffer(buffer), _filter(filter), _frame(0), _frame_start(0), _frame_stop(_buffer.get().frames()),
-        _playing(false), _on_finish([]() {}) {}
+        _buffer(buffer), _filter(filter), _frame(0), _frame_start(0), _frame_stop(buffer.frames()), _seek(-1),
+        _playing(false), _generation(0), _finished(0), _on_finish([]() {}), _jukebox(nullptr) {
+        publish();
+    }
+
+    Source::Source(CompressedBuffer &buffer, std::optional<FilterRef> filter) :
+        _compressed(buffer), _filter(filter), _frame(0), _frame_start(0), _frame_stop(buffer.frames()), _seek(-1),
+        _playing(false), _generation(0), _finished(0), _on_finish([]() {}), _jukebox(nullptr) {
+        publish();
+    }
+
+    Source::Source(Stream &stream, std::optional<FilterRef> filter) :
+        _stream(stream), _filter(filter), _frame(0), _frame_start(0), _frame_stop(stream.frames()), _seek(-1),
+        _playing(false), _generation(0), _finished(0), _on_finish([]() {}), _jukebox(nullptr) {
+        publish();
+    }
+
+    Source::~Source() {
+        if (_jukebox != nullptr) {
+            _jukebox->detach(*this);
+        }
+    }
+
+    double Source::length() const {
+        if (_stream.has_value()) {
+            return _stream.value().get().frames();
+        }
+        if (_compressed.has_value()) {
+            return _compressed.value().get().frames();
+        }
+        return _buffer.value().get().frames();
+    }
+
+    unsigned Source::channels() const {
+        if (_stream.has_value()) {
+            return _stream.value().get().channels();
+        }
+        if (_compressed.has_value()) {
+            return _compressed.value().get().channels();
+        }
+        return _buffer.value().get().channels();
+    }
+
+    double Source::sample_rate() const {
+        if (_stream.has_value()) {
+            return _stream.value().get().sample_rate();
+        }
+        if (_compressed.has_value()) {
+            return _compressed.value().get().sample_rate();
+        }
+        return _buffer.value().get().sample_rate();
+    }
 
     bool Source::is_playing() const { return _playing; }
 
+    void Source::publish() {
+        Parameters &parameters = _parameters.back();
+        parameters.position = position;
+        parameters.velocity = velocity;
+        parameters.volume = volume;
+        parameters.priority = priority;
+        _parameters.publish();
+
+        // Sends are copied into the back buffer, which keeps its capacity, so the mixer never sees them reallocate
+        Playback &playback = _playback.back();
+        playback.output = _output.has_value() ? &_output.value().get() : nullptr;
+        playback.sends = _sends;
+        playback.frame_stop = _frame_stop;
+        _playback.publish();
+    }
+
+    Source::Parameters Source::parameters() const {
+        _parameters.acquire();
+        return _parameters.front();
+    }
+
     void Source::seek(Seconds time) {
-        _frame = std::clamp(_frame_start + STANDARD_SAMPLE_RATE * time.count(),
-                            0.0,
-                            static_cast<double>(_buffer.get().frames()));
+        double frame = std::clamp(_frame_start + sample_rate() * time.count(), 0.0, length());
+        _seek.store(frame, std::memory_order_release);
     }
 
     void Source::set_start(Seconds time) {
-        _frame_start =
-            std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(_buffer.get().frames()));
+        _frame_start = std::clamp(sample_rate() * time.count(), 0.0, length());
     }
 
     void Source::set_stop(Seconds time) {
-        _frame_stop = std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(_buffer.get().frames()));
+        _frame_stop = std::clamp(sample_rate() * time.count(), 0.0, length());
     }
 
     void Source::set_duration(Seconds time) {
-        float count = STANDARD_SAMPLE_RATE * time.count();
-        _frame_stop = std::clamp(_frame_start + count, 0.0, static_cast<double>(_buffer.get().frames()));
+        float count = sample_rate() * time.count();
+        _frame_stop = std::clamp(_frame_start + count, 0.0, length());
     }
 
     void Source::set_on_finish(std::function<void()> handler) { _on_finish = handler; }
+
+    void Source::set_output(std::optional<std::reference_wrapper<Bus>> bus) { _output = bus; }
+
+    void Source::send(Bus &bus, float level) {
+        auto it = std::find_if(_sends.begin(), _sends.end(), [&](const Send &send) { return send.bus == &bus; });
+        if (it == _sends.end()) {
+            if (level != 0) {
+                _sends.push_back({&bus, level});
+            }
+        } else if (level == 0) {
+            _sends.erase(it);
+        } else {
+            it->level = level;
+        }
+    }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -3,29 +3,126 @@
 #include <atomic>
 #include <functional>
 #include <optional>
+#include <vector>
 
 #include <Math/Vec3.hpp>
+#include <Utils/TripleBuffer.hpp>
+
 #include <Sound/Buffer.hpp>
+#include <Sound/CompressedBuffer.hpp>
 #include <Sound/Filter.hpp>
+#include <Sound/Stream.hpp>
 
 namespace Dynamo::Sound {
+    class Bus;
+    class Jukebox;
+
     /**
      * @brief A playable source with associated processing data.
      *
      */
     class Source {
-        BufferRef _buffer;
+        std::optional<BufferRef> _buffer;
+        std::optional<CompressedBufferRef> _compressed;
+        std::optional<StreamRef> _stream;
         std::optional<FilterRef> _filter;
 
+        /**
+         * @brief Additional bus that receives a scaled copy of the source.
+         *
+         */
+        struct Send {
+            Bus *bus;
+            float level;
+        };
+        std::optional<std::reference_wrapper<Bus>> _output;
+        std::vector<Send> _sends;
+
+        /**
+         * @brief Routing and stop frame published to the mixer with the parameters.
+         *
+         */
+        struct Playback {
+            Bus *output = nullptr;
+            std::vector<Send> sends;
+            double frame_stop = 0;
+        };
+        TripleBuffer<Playback> _playback;
+
+        // The playhead belongs to the mixer, the start and stop frames to the thread that plays the source
         double _frame;
         double _frame_start;
         double _frame_stop;
 
+        /**
+         * @brief Frame requested by the last seek, or a negative value if
+         * the mixer has already applied it.
+         *
+         */
+        std::atomic<double> _seek;
+
         mutable std::atomic_bool _playing;
 
+        /**
+         * @brief Number of times the source has been played, so that the
+         * game thread can ignore finish reports from before it was played again.
+         *
+         */
+        std::atomic<unsigned> _generation;
+
+        /**
+         * @brief Last generation the mixer reported as finished.
+         *
+         */
+        unsigned _finished;
+
         std::function<void()> _on_finish;
 
+        /**
+         * @brief Jukebox the source was played on, which must stop using it
+         * before it is destroyed.
+         *
+         */
+        Jukebox *_jukebox;
+
         friend class Jukebox;
+        friend class VoiceManager;
+
+        /**
+         * @brief Get the number of frames in the audio.
+         *
+         * @return double
+         */
+        double length() const;
+
+        /**
+         * @brief Get the number of channels of the audio.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the sample rate of the audio.
+         *
+         * @return double
+         */
+        double sample_rate() const;
+
+      public:
+        /**
+         * @brief Snapshot of the parameters read by the mixer.
+         *
+         */
+        struct Parameters {
+            Vec3 position;
+            Vec3 velocity;
+            float volume = 1;
+            int priority = 0;
+        };
+
+      private:
+        mutable TripleBuffer<Parameters> _parameters;
 
       public:
         /**
@@ -40,6 +137,19 @@ namespace Dynamo::Sound {
          */
         Vec3 velocity;
 
+        /**
+         * @brief Volume multiplier of the source.
+         *
+         */
+        float volume = 1;
+
+        /**
+         * @brief Priority of the source when there are more audible sources
+         * than real voices. Higher priority sources are processed first.
+         *
+         */
+        int priority = 0;
+
         /**
          * @brief Construct a new sound source.
          *
@@ -48,6 +158,31 @@ namespace Dynamo::Sound {
          */
         Source(Buffer &buffer, std::optional<FilterRef> filter = {});
 
+        /**
+         * @brief Construct a new sound source that plays a compressed buffer.
+         *
+         * @param buffer
+         * @param filter
+         */
+        Source(CompressedBuffer &buffer, std::optional<FilterRef> filter = {});
+
+        /**
+         * @brief Construct a new sound source that plays a stream.
+         *
+         * @param stream
+         * @param filter
+         */
+        Source(Stream &stream, std::optional<FilterRef> filter = {});
+
+        /**
+         * @brief Destroy the Source object.
+         *
+         * If the source was played, this pauses it and waits until the mixer
+         * no longer uses it, so it must be destroyed on the thread that plays it.
+         *
+         */
+        ~Source();
+
         /**
          * @brief Check if the source is playing.
          *
@@ -56,9 +191,31 @@ namespace Dynamo::Sound {
          */
         bool is_playing() const;
 
+        /**
+         * @brief Publish the position, velocity, volume, priority, routing, and
+         * stop time to the mixer.
+         *
+         * These fields belong to the thread that plays the source, while the
+         * mixer and filters read the last published snapshot. Jukebox
+         * publishes its playing sources on commit().
+         *
+         */
+        void publish();
+
+        /**
+         * @brief Get the latest parameters published to the mixer.
+         *
+         * This must only be called from the thread processing the source.
+         *
+         * @return Parameters
+         */
+        Parameters parameters() const;
+
         /**
          * @brief Set the seek time relative to the start offset.
          *
+         * The playhead is moved by the mixer at the start of its next chunk.
+         *
          * @param time
          */
         void seek(Seconds time);
@@ -73,6 +230,8 @@ namespace Dynamo::Sound {
         /**
          * @brief Set the stop time offset.
          *
+         * Like the other parameters, this takes effect when it is published.
+         *
          * @param time
          */
         void set_stop(Seconds time);
@@ -81,6 +240,8 @@ namespace Dynamo::Sound {
          * @brief Calculate the stop time offset using a duration from the
          * current start offset.
          *
+         * Like the other parameters, this takes effect when it is published.
+         *
          * @param time
          */
         void set_duration(Seconds time);
@@ -88,9 +249,34 @@ namespace Dynamo::Sound {
         /**
          * @brief Set the on finish handler.
          *
+         * It is called on the thread that plays the source, when the Jukebox
+         * commits after the mixer has reached the stop time.
+         *
          * @param handler
          */
         void set_on_finish(std::function<void()> handler);
+
+        /**
+         * @brief Set the bus the source is mixed into, or the master if empty.
+         *
+         * Like the other parameters, this takes effect when it is published.
+         *
+         * @param bus
+         */
+        void set_output(std::optional<std::reference_wrapper<Bus>> bus);
+
+        /**
+         * @brief Send a copy of the source to a bus in addition to its output,
+         * e.g., to share a reverb between sources.
+         *
+         * Setting the level of an existing send updates it, and a level of 0
+         * removes it. Like the other parameters, this takes effect when it is
+         * published.
+         *
+         * @param bus
+         * @param level Send level multiplier
+         */
+        void send(Bus &bus, float level);
     };
 
     using SourceRef = std::reference_wrapper<Source>;
@@ -0,0 +1,123 @@
+#pragma once
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Snapshot of the performance counters of the audio engine.
+     *
+     * Counts and times accumulate from the construction of the Jukebox or
+     * the last reset. Times are in seconds.
+     *
+     */
+    struct Stats {
+        /**
+         * @brief Number of output callbacks in which the device ran out of samples.
+         *
+         */
+        unsigned output_underflows = 0;
+
+        /**
+         * @brief Number of output callbacks in which the device dropped samples.
+         *
+         */
+        unsigned output_overflows = 0;
+
+        /**
+         * @brief Number of input callbacks in which the device ran out of samples.
+         *
+         */
+        unsigned input_underflows = 0;
+
+        /**
+         * @brief Number of input callbacks in which the device or the input
+         * buffer dropped samples.
+         *
+         */
+        unsigned input_overflows = 0;
+
+        /**
+         * @brief Number of frames silenced by the output callback because the
+         * mixer had not filled the output buffer in time.
+         *
+         */
+        unsigned dropped_frames = 0;
+
+        /**
+         * @brief Number of frames currently mixed ahead in the output buffer.
+         *
+         */
+        unsigned buffered_frames = 0;
+
+        /**
+         * @brief Number of chunks mixed.
+         *
+         * In real-time mode, each output callback counts as one chunk.
+         *
+         */
+        unsigned chunks = 0;
+
+        /**
+         * @brief Number of chunks that took longer to mix than they take to play.
+         *
+         */
+        unsigned late_chunks = 0;
+
+        /**
+         * @brief Total time spent mixing chunks.
+         *
+         */
+        double mix_time = 0;
+
+        /**
+         * @brief Longest time spent mixing a single chunk.
+         *
+         */
+        double max_mix_time = 0;
+
+        /**
+         * @brief Highest ratio of the time spent mixing a chunk to its duration.
+         *
+         * The mixer cannot keep up once this exceeds 1.
+         *
+         */
+        double max_load = 0;
+
+        /**
+         * @brief Number of source chunks processed by the real voices.
+         *
+         * The stage times below are summed over the mixer threads, so together
+         * they can exceed the mix time when sources are mixed in parallel.
+         *
+         */
+        unsigned voice_chunks = 0;
+
+        /**
+         * @brief Total time spent reading and resampling sources.
+         *
+         */
+        double resample_time = 0;
+
+        /**
+         * @brief Total time spent applying source filters.
+         *
+         */
+        double filter_time = 0;
+
+        /**
+         * @brief Total time spent remixing sources onto the master and the buses.
+         *
+         */
+        double remix_time = 0;
+
+        /**
+         * @brief Number of real voices in the last chunk.
+         *
+         */
+        unsigned real_voices = 0;
+
+        /**
+         * @brief Number of virtual voices in the last chunk.
+         *
+         */
+        unsigned virtual_voices = 0;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
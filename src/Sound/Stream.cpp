@@ -0,0 +1,157 @@
+#include <chrono>
+#include <cmath>
+
+#include <Math/Vectorize.hpp>
+#include <Sound/Stream.hpp>
+
+namespace Dynamo::Sound {
+    Stream::Stream(std::unique_ptr<Decoder> decoder) :
+        _decoder(std::move(decoder)), _generation(0), _next(0), _seek_generation(0), _seek_frame(0),
+        _position(0), _terminate(false) {
+        unsigned channels = _decoder->channels();
+        _frames = _decoder->frames();
+
+        for (unsigned i = 0; i < STREAM_BLOCK_COUNT; i++) {
+            _blocks[i].samples.resize(STREAM_BLOCK_LENGTH, channels);
+            _free.write(i);
+        }
+        _held.reserve(STREAM_BLOCK_COUNT);
+        _interleaved.resize(STREAM_BLOCK_LENGTH * channels);
+
+        _thread = std::thread([this]() { decode_main(); });
+    }
+
+    Stream::~Stream() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _terminate = true;
+        }
+        _signal.notify_one();
+        _thread.join();
+    }
+
+    void Stream::decode_main() {
+        unsigned generation = 0;
+        unsigned frame = 0;
+        while (!_terminate) {
+            // Restart from the latest seek request
+            unsigned seek_generation = _seek_generation.load(std::memory_order_acquire);
+            if (seek_generation != generation) {
+                generation = seek_generation;
+                frame = _seek_frame.load(std::memory_order_relaxed);
+            }
+
+            // Sleep until a block is released or a seek is requested.
+            // The reader signals without the lock, so wake up periodically in case it was missed.
+            if (frame >= _frames || _free.empty()) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _signal.wait_for(lock, std::chrono::milliseconds(10), [&]() {
+                    return _terminate || _seek_generation.load(std::memory_order_acquire) != generation ||
+                           (frame < _frames && !_free.empty());
+                });
+                continue;
+            }
+
+            unsigned index = _free.read();
+            Block &block = _blocks[index];
+            block.frame = frame;
+            block.generation = generation;
+            decode_block(block);
+            _ready.write(index);
+
+            frame += block.frames;
+        }
+    }
+
+    void Stream::decode_block(Block &block) {
+        unsigned channels = block.samples.channels();
+        block.frames = std::min(STREAM_BLOCK_LENGTH, _frames - block.frame);
+
+        // Only seek the decoder if the block does not continue from the last one
+        if (block.frame != _position) {
+            _decoder->seek(block.frame);
+        }
+        unsigned count = _decoder->read(_interleaved.data(), block.frames);
+        Vectorize::vdeinterleave(_interleaved.data(), channels, block.samples.data(), block.samples.frames(), count);
+        _position = block.frame + count;
+
+        // Silence frames the decoder could not provide
+        for (unsigned c = 0; c < channels; c++) {
+            std::fill(block.samples[c] + count, block.samples[c] + block.frames, 0);
+        }
+    }
+
+    void Stream::request_seek(unsigned frame) {
+        for (unsigned index : _held) {
+            _free.write(index);
+        }
+        _held.clear();
+
+        _generation++;
+        _next = frame;
+        _seek_frame.store(frame, std::memory_order_relaxed);
+        _seek_generation.store(_generation, std::memory_order_release);
+    }
+
+    unsigned Stream::channels() const { return _decoder->channels(); }
+
+    double Stream::sample_rate() const { return _decoder->sample_rate(); }
+
+    unsigned Stream::frames() const { return _frames; }
+
+    void Stream::read(unsigned start, Buffer &dst) {
+        DYN_ASSERT(dst.channels() == channels());
+        bool released = false;
+
+        // Collect the blocks decoded since the last read, dropping those from before a seek
+        while (!_ready.empty()) {
+            unsigned index = _ready.read();
+            const Block &block = _blocks[index];
+            if (block.generation == _generation && block.frame == _next) {
+                _held.push_back(index);
+                _next += block.frames;
+            } else {
+                _free.write(index);
+                released = true;
+            }
+        }
+
+        // Release the blocks behind the read position
+        unsigned behind = 0;
+        while (behind < _held.size()) {
+            const Block &block = _blocks[_held[behind]];
+            if (block.frame + block.frames > start) {
+                break;
+            }
+            _free.write(_held[behind++]);
+        }
+        _held.erase(_held.begin(), _held.begin() + behind);
+        released |= behind > 0;
+
+        // Seek if the range is behind the held blocks or past the read-ahead
+        unsigned first = _held.empty() ? _next : _blocks[_held.front()].frame;
+        if (start < first || start >= _next + STREAM_BLOCK_LENGTH * STREAM_BLOCK_COUNT) {
+            request_seek(start);
+            released = true;
+        }
+        if (released) {
+            _signal.notify_one();
+        }
+
+        // Copy the parts of the held blocks that overlap the range
+        dst.silence();
+        unsigned end = start + dst.frames();
+        for (unsigned index : _held) {
+            const Block &block = _blocks[index];
+            unsigned lo = std::max(start, block.frame);
+            unsigned hi = std::min(end, block.frame + block.frames);
+            if (lo >= hi) {
+                continue;
+            }
+            for (unsigned c = 0; c < dst.channels(); c++) {
+                const WaveSample *src = block.samples[c];
+                std::copy(src + (lo - block.frame), src + (hi - block.frame), dst[c] + (lo - start));
+            }
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Sound/Buffer.hpp>
+#include <Utils/RingBuffer.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of frames in a decoded stream block.
+     *
+     */
+    static constexpr unsigned STREAM_BLOCK_LENGTH = 1 << 12;
+
+    /**
+     * @brief Number of blocks held by a stream, bounding its read-ahead and memory.
+     *
+     */
+    static constexpr unsigned STREAM_BLOCK_COUNT = 8;
+
+    /**
+     * @brief Incremental reader of encoded audio.
+     *
+     */
+    class Decoder {
+      public:
+        virtual ~Decoder() = default;
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        virtual unsigned channels() const = 0;
+
+        /**
+         * @brief Get the sample rate.
+         *
+         * @return double
+         */
+        virtual double sample_rate() const = 0;
+
+        /**
+         * @brief Get the total number of frames.
+         *
+         * @return unsigned
+         */
+        virtual unsigned frames() const = 0;
+
+        /**
+         * @brief Move the read position to a frame.
+         *
+         * @param frame
+         */
+        virtual void seek(unsigned frame) = 0;
+
+        /**
+         * @brief Read interleaved frames from the current position, returning
+         * the number of frames read.
+         *
+         * @param dst    Destination of interleaved samples
+         * @param frames Maximum number of frames
+         * @return unsigned
+         */
+        virtual unsigned read(WaveSample *dst, unsigned frames) = 0;
+    };
+
+    /**
+     * @brief Audio that is decoded on a background thread while it plays.
+     *
+     * The decoder thread fills a fixed set of blocks ahead of the read position,
+     * so memory stays bounded regardless of the length of the audio. Reading a
+     * range that is not near the decoded blocks seeks the decoder.
+     *
+     * Blocks keep the sample rate of the decoder, so the mixer resamples the
+     * audio in a single pass like any other source.
+     *
+     * A stream should only be played by one source at a time.
+     *
+     */
+    class Stream {
+        struct Block {
+            Buffer samples;
+            unsigned frame;
+            unsigned frames;
+            unsigned generation;
+        };
+
+        std::unique_ptr<Decoder> _decoder;
+        unsigned _frames;
+
+        std::array<Block, STREAM_BLOCK_COUNT> _blocks;
+        RingBuffer<unsigned, STREAM_BLOCK_COUNT> _free;
+        RingBuffer<unsigned, STREAM_BLOCK_COUNT> _ready;
+
+        // Reader state
+        std::vector<unsigned> _held;
+        unsigned _generation;
+        unsigned _next;
+
+        // Seek requests from the reader
+        std::atomic<unsigned> _seek_generation;
+        std::atomic<unsigned> _seek_frame;
+
+        // Decoder state
+        unsigned _position;
+        std::vector<WaveSample> _interleaved;
+
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _signal;
+        std::atomic_bool _terminate;
+
+        /**
+         * @brief Decoder thread loop.
+         *
+         */
+        void decode_main();
+
+        /**
+         * @brief Decode a block starting at a frame.
+         *
+         * @param block
+         */
+        void decode_block(Block &block);
+
+        /**
+         * @brief Request the decoder thread to restart from a frame.
+         *
+         * @param frame
+         */
+        void request_seek(unsigned frame);
+
+      public:
+        /**
+         * @brief Start streaming from a decoder.
+         *
+         * @param decoder
+         */
+        Stream(std::unique_ptr<Decoder> decoder);
+        ~Stream();
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the sample rate.
+         *
+         * @return double
+         */
+        double sample_rate() const;
+
+        /**
+         * @brief Get the total number of frames.
+         *
+         * @return unsigned
+         */
+        unsigned frames() const;
+
+        /**
+         * @brief Read frames starting at a frame into the destination buffer.
+         *
+         * Frames that have not been decoded yet are silenced. This does not
+         * block, allocate, or lock, and must only be called from one thread.
+         *
+         * @param start First frame
+         * @param dst   Destination buffer
+         */
+        void read(unsigned start, Buffer &dst);
+    };
+
+    using StreamRef = std::reference_wrapper<Stream>;
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <algorithm>
+
+#include <Sound/VoiceManager.hpp>
+
+namespace Dynamo::Sound {
+    VoiceManager::VoiceManager(unsigned max_voices, float threshold) :
+        _max_voices(max_voices), _threshold(threshold) {}
+
+    float VoiceManager::audibility(const Source &source, const Listener &listener, float volume) {
+        float gain = volume * source.parameters().volume;
+        if (source._filter.has_value()) {
+            Filter &filter = source._filter.value();
+            gain *= filter.estimate_gain(source, listener);
+        }
+        return gain;
+    }
+
+    void VoiceManager::update(const std::vector<SourceRef> &sources, const Listener &listener, float volume) {
+        _candidates.clear();
+        _real.clear();
+        _virtual.clear();
+
+        // Cull the sources that cannot be heard
+        for (unsigned i = 0; i < sources.size(); i++) {
+            Source &source = sources[i];
+            float gain = audibility(source, listener, volume);
+            if (gain < _threshold) {
+                _virtual.push_back(&source);
+            } else {
+                _candidates.push_back({&source, gain, source.parameters().priority, i});
+            }
+        }
+
+        // Keep the most important audible sources
+        if (_candidates.size() > _max_voices) {
+            auto cutoff = _candidates.begin() + _max_voices;
+            std::nth_element(_candidates.begin(), cutoff, _candidates.end(), [](const Voice &a, const Voice &b) {
+                if (a.priority != b.priority) {
+                    return a.priority > b.priority;
+                }
+                if (a.audibility != b.audibility) {
+                    return a.audibility > b.audibility;
+                }
+                return a.index < b.index;
+            });
+            for (auto it = cutoff; it != _candidates.end(); it++) {
+                _virtual.push_back(it->source);
+            }
+            _candidates.erase(cutoff, _candidates.end());
+
+            // Restore the source order so mixing stays deterministic
+            std::sort(_candidates.begin(), _candidates.end(), [](const Voice &a, const Voice &b) {
+                return a.index < b.index;
+            });
+        }
+        for (const Voice &voice : _candidates) {
+            _real.push_back(voice.source);
+        }
+    }
+
+    void VoiceManager::reserve(unsigned count) {
+        _candidates.reserve(count);
+        _real.reserve(count);
+        _virtual.reserve(count);
+    }
+
+    const std::vector<Source *> &VoiceManager::real_voices() const { return _real; }
+
+    const std::vector<Source *> &VoiceManager::virtual_voices() const { return _virtual; }
+
+    void VoiceManager::set_max_voices(unsigned max_voices) { _max_voices = max_voices; }
+
+    unsigned VoiceManager::get_max_voices() const { return _max_voices; }
+
+    void VoiceManager::set_threshold(float threshold) { _threshold = threshold; }
+
+    float VoiceManager::get_threshold() const { return _threshold; }
+} // namespace Dynamo::Sound
\ No newline at end of file
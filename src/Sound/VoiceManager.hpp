@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+
+#include <Sound/Listener.hpp>
+#include <Sound/Source.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Default maximum number of sources processed per chunk.
+     *
+     */
+    static constexpr unsigned DEFAULT_MAX_VOICES = 32;
+
+    /**
+     * @brief Default gain below which a source is considered inaudible (-60 dB).
+     *
+     */
+    static constexpr float DEFAULT_AUDIBILITY_THRESHOLD = 1e-3;
+
+    /**
+     * @brief Selects which playing sources are worth processing.
+     *
+     * Each source is given an audibility estimate from its volume and the
+     * gain its filter is expected to apply. Sources below the audibility
+     * threshold, and sources that do not fit within the maximum number of
+     * real voices, become virtual. Virtual sources keep advancing their
+     * playhead but are not resampled, filtered, or mixed.
+     *
+     * Real voices are chosen by priority first and then by audibility.
+     *
+     */
+    class VoiceManager {
+        struct Voice {
+            Source *source;
+            float audibility;
+            int priority;
+            unsigned index;
+        };
+        std::vector<Voice> _candidates;
+
+        std::vector<Source *> _real;
+        std::vector<Source *> _virtual;
+
+        unsigned _max_voices;
+        float _threshold;
+
+      public:
+        /**
+         * @brief Construct a new VoiceManager object.
+         *
+         * @param max_voices Maximum number of real voices
+         * @param threshold  Audibility threshold
+         */
+        VoiceManager(unsigned max_voices = DEFAULT_MAX_VOICES, float threshold = DEFAULT_AUDIBILITY_THRESHOLD);
+
+        /**
+         * @brief Estimate the gain of a source as heard by the listener.
+         *
+         * @param source
+         * @param listener
+         * @param volume   Master volume
+         * @return float
+         */
+        static float audibility(const Source &source, const Listener &listener, float volume);
+
+        /**
+         * @brief Split the sources into real and virtual voices.
+         *
+         * The relative order of the real voices follows the order of the sources.
+         *
+         * @param sources
+         * @param listener
+         * @param volume   Master volume
+         */
+        void update(const std::vector<SourceRef> &sources, const Listener &listener, float volume);
+
+        /**
+         * @brief Reserve space for a number of sources so update() does not allocate.
+         *
+         * @param count
+         */
+        void reserve(unsigned count);
+
+        /**
+         * @brief Get the sources to be processed.
+         *
+         * @return const std::vector<Source *>&
+         */
+        const std::vector<Source *> &real_voices() const;
+
+        /**
+         * @brief Get the sources that only advance their playhead.
+         *
+         * @return const std::vector<Source *>&
+         */
+        const std::vector<Source *> &virtual_voices() const;
+
+        /**
+         * @brief Set the maximum number of real voices.
+         *
+         * @param max_voices
+         */
+        void set_max_voices(unsigned max_voices);
+
+        /**
+         * @brief Get the maximum number of real voices.
+         *
+         * @return unsigned
+         */
+        unsigned get_max_voices() const;
+
+        /**
+         * @brief Set the audibility threshold.
+         *
+         * @param threshold
+         */
+        void set_threshold(float threshold);
+
+        /**
+         * @brief Get the audibility threshold.
+         *
+         * @return float
+         */
+        float get_threshold() const;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Dynamo {
+    /**
+     * @brief Bounded lock-free queue that supports multiple producers and
+     * multiple consumers.
+     *
+     * Each slot carries a sequence number that tells producers and consumers
+     * whether it is ready to be written or read, so threads only contend on
+     * the shared enqueue and dequeue positions. Those positions are kept on
+     * separate cache lines to avoid false sharing.
+     *
+     * Based on Dmitry Vyukov's bounded MPMC queue
+     * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+     *
+     * @tparam T Type of element, must be default constructible and movable.
+     * @tparam N Maximum size of the container (power of 2).
+     */
+    template <typename T, unsigned N>
+    class ConcurrentQueue {
+        static constexpr unsigned MASK = N - 1;
+        static_assert(N > 1 && (N & MASK) == 0, "ConcurrentQueue size (> 1) should be a power of 2");
+        static_assert(std::is_default_constructible<T>::value, "ConcurrentQueue element must be default constructible");
+
+        struct Slot {
+            std::atomic<unsigned> sequence;
+            T value;
+        };
+
+        alignas(64) std::array<Slot, N> _slots;
+        alignas(64) std::atomic<unsigned> _enqueue;
+        alignas(64) std::atomic<unsigned> _dequeue;
+
+        /**
+         * @brief Claim up to n consecutive slots whose sequence is offset
+         * from their position by a fixed amount.
+         *
+         * Returns the first claimed position and the number of slots claimed.
+         *
+         * @param position Shared position to advance.
+         * @param offset   Expected sequence offset for a ready slot.
+         * @param n        Maximum number of slots.
+         * @param start    First claimed position.
+         * @return unsigned
+         */
+        inline unsigned claim(std::atomic<unsigned> &position, unsigned offset, unsigned n, unsigned &start) {
+            unsigned pos = position.load(std::memory_order_relaxed);
+            while (true) {
+                // Count the ready slots from the current position
+                unsigned count = 0;
+                bool stale = false;
+                while (count < n) {
+                    unsigned seq = _slots[(pos + count) & MASK].sequence.load(std::memory_order_acquire);
+                    int diff = static_cast<int>(seq - (pos + count + offset));
+                    if (diff != 0) {
+                        // Another thread has already claimed the first slot
+                        stale = count == 0 && diff > 0;
+                        break;
+                    }
+                    count++;
+                }
+
+                if (stale) {
+                    pos = position.load(std::memory_order_relaxed);
+                } else if (count == 0) {
+                    return 0;
+                } else if (position.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    start = pos;
+                    return count;
+                }
+            }
+        }
+
+      public:
+        /**
+         * @brief Construct a new ConcurrentQueue object.
+         *
+         */
+        ConcurrentQueue() : _enqueue(0), _dequeue(0) {
+            for (unsigned i = 0; i < N; i++) {
+                _slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Get the approximate number of elements in the queue.
+         *
+         * This is only exact when no other thread is operating on the queue.
+         *
+         * @return unsigned
+         */
+        inline unsigned size() const {
+            unsigned dequeue = _dequeue.load(std::memory_order_acquire);
+            unsigned enqueue = _enqueue.load(std::memory_order_acquire);
+            return std::min(enqueue - dequeue, N);
+        }
+
+        /**
+         * @brief Check if the queue is approximately empty.
+         *
+         * @return true
+         * @return false
+         */
+        inline bool empty() const { return size() == 0; }
+
+        /**
+         * @brief Get the maximum number of elements in the queue.
+         *
+         * @return unsigned
+         */
+        inline constexpr unsigned capacity() const { return N; }
+
+        /**
+         * @brief Push a value, returning false if the queue is full.
+         *
+         * @param value
+         * @return true
+         * @return false
+         */
+        inline bool push(T value) {
+            unsigned start;
+            if (claim(_enqueue, 0, 1, start) == 0) {
+                return false;
+            }
+            Slot &slot = _slots[start & MASK];
+            slot.value = std::move(value);
+            slot.sequence.store(start + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Push up to n values, returning the number of values pushed.
+         *
+         * The values pushed are a prefix of the source array and will be
+         * consumed in order.
+         *
+         * @param src
+         * @param n
+         * @return unsigned
+         */
+        inline unsigned push(const T *src, unsigned n) {
+            unsigned start;
+            unsigned count = claim(_enqueue, 0, n, start);
+            for (unsigned i = 0; i < count; i++) {
+                Slot &slot = _slots[(start + i) & MASK];
+                slot.value = src[i];
+                slot.sequence.store(start + i + 1, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Pop a value, returning nothing if the queue is empty.
+         *
+         * @return std::optional<T>
+         */
+        inline std::optional<T> pop() {
+            T value;
+            if (pop(&value, 1) == 1) {
+                return value;
+            }
+            return {};
+        }
+
+        /**
+         * @brief Pop up to n values, returning the number of values popped.
+         *
+         * @param dst
+         * @param n
+         * @return unsigned
+         */
+        inline unsigned pop(T *dst, unsigned n) {
+            unsigned start;
+            unsigned count = claim(_dequeue, 1, n, start);
+            for (unsigned i = 0; i < count; i++) {
+                Slot &slot = _slots[(start + i) & MASK];
+                dst[i] = std::move(slot.value);
+                slot.sequence.store(start + i + N, std::memory_order_release);
+            }
+            return count;
+        }
+    };
+} // namespace Dynamo
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <Utils/ConcurrentQueue.hpp>
+
+namespace Dynamo {
+    /**
+     * @brief A pool of threads that runs jobs in order of earliest deadline.
+     *
+     * A thread that needs the result of a job waits on it at its deadline.
+     * If no worker has started the job by then, it is run inline by the
+     * waiting thread instead, so a late job is never stuck behind others in
+     * the queue.
+     *
+     * Submitting a pre-allocated task and waiting on it never lock or
+     * allocate, so both can be done from the audio callback. Tasks are
+     * handed to the workers through a lock-free queue, and a waiter spins
+     * while a worker finishes the task rather than blocking.
+     *
+     */
+    class DeadlineScheduler {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Reusable job, which can be submitted again once it is done.
+         *
+         */
+        class Task {
+            enum State : unsigned {
+                Queued,
+                Running,
+                Done,
+            };
+
+            std::function<void()> _job;
+            std::atomic<unsigned> _state;
+
+            /**
+             * @brief Claim and run the job if it has not been started.
+             *
+             * @return true
+             * @return false
+             */
+            bool try_run() {
+                unsigned expected = Queued;
+                if (!_state.compare_exchange_strong(expected, Running)) {
+                    return false;
+                }
+                _job();
+                _state.store(Done, std::memory_order_release);
+                return true;
+            }
+
+            friend DeadlineScheduler;
+
+          public:
+            /**
+             * @brief Construct a new Task object that has not been submitted.
+             *
+             * @param job Callable function.
+             */
+            Task(std::function<void()> job) : _job(std::move(job)), _state(Done) {}
+
+            /**
+             * @brief Check if the job has finished since it was last submitted.
+             *
+             * @return true
+             * @return false
+             */
+            bool done() const { return _state.load(std::memory_order_acquire) == Done; }
+        };
+
+        using TaskRef = std::shared_ptr<Task>;
+
+      private:
+        /**
+         * @brief Maximum number of submissions that have not been seen by a
+         * worker. Tasks submitted beyond it are run inline.
+         *
+         */
+        static constexpr unsigned QUEUE_SIZE = 1 << 8;
+
+        /**
+         * @brief Interval at which idle workers check for submissions, in
+         * case a wakeup was missed.
+         *
+         */
+        static constexpr std::chrono::milliseconds WAKE_INTERVAL{1};
+
+        /**
+         * @brief Submitted task with the deadline it was submitted with.
+         *
+         */
+        struct Entry {
+            TaskRef task;
+            Clock::time_point deadline;
+        };
+
+        /**
+         * @brief Order tasks so that the earliest deadline is at the top of the queue.
+         *
+         */
+        struct Later {
+            bool operator()(const Entry &a, const Entry &b) const { return a.deadline > b.deadline; }
+        };
+
+        std::vector<std::thread> _threads;
+        ConcurrentQueue<Entry, QUEUE_SIZE> _submitted;
+
+        // Tasks are ordered by the workers, so the lock is never taken by a submitter
+        std::priority_queue<Entry, std::vector<Entry>, Later> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _signal;
+
+        bool _terminate = false;
+
+        /**
+         * @brief Main thread loop that runs the task with the earliest deadline.
+         *
+         * A task that was run inline and submitted again may still be in the
+         * queue. Whichever entry claims it first runs the latest submission,
+         * and the other is skipped.
+         *
+         */
+        void thread_main() {
+            while (true) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                Entry entry;
+                while (_submitted.pop(&entry, 1) == 1) {
+                    _tasks.push(std::move(entry));
+                }
+                if (_terminate) {
+                    return;
+                }
+
+                // Submitters signal without the lock, so a wakeup may be missed
+                if (_tasks.empty()) {
+                    _signal.wait_for(lock, WAKE_INTERVAL);
+                    continue;
+                }
+                TaskRef task = _tasks.top().task;
+                _tasks.pop();
+                lock.unlock();
+
+                // Tasks already claimed by a waiter are skipped
+                task->try_run();
+            }
+        }
+
+      public:
+        /**
+         * @brief Construct a new DeadlineScheduler object.
+         *
+         * @param pool_size Number of threads in the pool.
+         */
+        DeadlineScheduler(unsigned pool_size = 1) {
+            _threads.resize(pool_size);
+            for (unsigned i = 0; i < pool_size; i++) {
+                _threads[i] = std::thread([this]() { thread_main(); });
+            }
+        }
+
+        /**
+         * @brief Destroy the DeadlineScheduler object.
+         *
+         * Tasks that have not been started are not run.
+         *
+         */
+        ~DeadlineScheduler() {
+            {
+                std::scoped_lock<std::mutex> lock(_mutex);
+                _terminate = true;
+                _signal.notify_all();
+            }
+            for (std::thread &thread : _threads) {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Get the scheduler shared by default between audio processors.
+         *
+         * @return DeadlineScheduler&
+         */
+        static DeadlineScheduler &shared() {
+            static DeadlineScheduler scheduler;
+            return scheduler;
+        }
+
+        /**
+         * @brief Submit a task to run before a deadline.
+         *
+         * The task must be done, e.g., waited on, before it is submitted again.
+         * This does not lock or allocate.
+         *
+         * @param task     Pre-allocated task.
+         * @param deadline Time by which the result is needed.
+         */
+        void submit(const TaskRef &task, Clock::time_point deadline) {
+            task->_state.store(Task::Queued, std::memory_order_release);
+            if (!_submitted.push({task, deadline})) {
+                task->try_run();
+                return;
+            }
+            _signal.notify_one();
+        }
+
+        /**
+         * @brief Submit a job to run before a deadline.
+         *
+         * This allocates a new task, so it should not be used on the audio
+         * thread.
+         *
+         * @param job      Callable function.
+         * @param deadline Time by which the result is needed.
+         * @return TaskRef
+         */
+        TaskRef submit(std::function<void()> job, Clock::time_point deadline) {
+            TaskRef task = std::make_shared<Task>(std::move(job));
+            submit(task, deadline);
+            return task;
+        }
+
+        /**
+         * @brief Wait for a task to finish, running it on the calling thread
+         * if no worker has started it.
+         *
+         * If a worker is running the task, this spins until it is done
+         * instead of blocking on a lock.
+         *
+         * @param task
+         */
+        void wait(const TaskRef &task) {
+            if (task->try_run()) {
+                return;
+            }
+            while (!task->done()) {
+                std::this_thread::yield();
+            }
+        }
+    };
+} // namespace Dynamo
\ No newline at end of file
@@ -0,0 +1,529 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <Utils/Bits.hpp>
+#include <Utils/Log.hpp>
+
+namespace Dynamo {
+    /**
+     * @brief Associative container using open addressing with group probing.
+     *
+     * Entries are stored in a flat slot array alongside a parallel array of
+     * control bytes. Each control byte marks its slot as empty, deleted, or
+     * full with 7 bits of the key's hash. Lookups compare a group of 16
+     * control bytes at once (with SSE2 where available) and only compare keys
+     * whose hash bits match, so most probes never touch the slot array.
+     *
+     * Based on the SwissTable design https://abseil.io/about/design/swisstables
+     *
+     * Iterators and references are invalidated by insertion.
+     *
+     * @tparam K     Key type.
+     * @tparam V     Value type.
+     * @tparam Hash  Key hash function.
+     * @tparam Equal Key equality function.
+     */
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>>
+    class FlatMap {
+      public:
+        using value_type = std::pair<const K, V>;
+
+      private:
+        static constexpr unsigned GROUP_WIDTH = 16;
+        static constexpr int8_t CTRL_EMPTY = -128;
+        static constexpr int8_t CTRL_DELETED = -2;
+
+        /**
+         * @brief Group of control bytes that can be matched simultaneously.
+         *
+         */
+        struct Group {
+#if defined(__SSE2__)
+            __m128i ctrl;
+
+            Group(const int8_t *ptr) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))) {}
+
+            inline unsigned match(int8_t h2) const {
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+            }
+
+            inline unsigned match_empty() const { return match(CTRL_EMPTY); }
+
+            inline unsigned match_available() const { return _mm_movemask_epi8(ctrl); }
+#else
+            const int8_t *ctrl;
+
+            Group(const int8_t *ptr) : ctrl(ptr) {}
+
+            inline unsigned match(int8_t h2) const {
+                unsigned mask = 0;
+                for (unsigned i = 0; i < GROUP_WIDTH; i++) {
+                    mask |= static_cast<unsigned>(ctrl[i] == h2) << i;
+                }
+                return mask;
+            }
+
+            inline unsigned match_empty() const { return match(CTRL_EMPTY); }
+
+            inline unsigned match_available() const {
+                unsigned mask = 0;
+                for (unsigned i = 0; i < GROUP_WIDTH; i++) {
+                    mask |= static_cast<unsigned>(ctrl[i] < 0) << i;
+                }
+                return mask;
+            }
+#endif
+        };
+
+        std::unique_ptr<int8_t[]> _ctrl;
+        value_type *_slots = nullptr;
+        unsigned _capacity = 0;
+        unsigned _size = 0;
+        unsigned _deleted = 0;
+
+        Hash _hash;
+        Equal _equal;
+
+        /**
+         * @brief Mix the user hash so that both the group index and the
+         * control bits are well distributed.
+         *
+         * @param key
+         * @return uint64_t
+         */
+        inline uint64_t hash(const K &key) const {
+            uint64_t h = static_cast<uint64_t>(_hash(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        /**
+         * @brief Find the slot index of a key, or the capacity if it does not exist.
+         *
+         * @param key
+         * @param h
+         * @return unsigned
+         */
+        inline unsigned lookup(const K &key, uint64_t h) const {
+            if (_capacity == 0) return 0;
+
+            int8_t h2 = h & 0x7f;
+            unsigned group_mask = (_capacity / GROUP_WIDTH) - 1;
+            unsigned group = (h >> 7) & group_mask;
+            for (unsigned probe = 1;; probe++) {
+                unsigned base = group * GROUP_WIDTH;
+                Group g(_ctrl.get() + base);
+                for (unsigned mask = g.match(h2); mask; mask &= mask - 1) {
+                    unsigned index = base + find_lsb(mask);
+                    if (_equal(_slots[index].first, key)) {
+                        return index;
+                    }
+                }
+                if (g.match_empty() || probe > group_mask) {
+                    return _capacity;
+                }
+                group = (group + probe) & group_mask;
+            }
+        }
+
+        /**
+         * @brief Find the first empty or deleted slot along a key's probe sequence.
+         *
+         * @param h
+         * @return unsigned
+         */
+        inline unsigned find_available(uint64_t h) const {
+            unsigned group_mask = (_capacity / GROUP_WIDTH) - 1;
+            unsigned group = (h >> 7) & group_mask;
+            for (unsigned probe = 1;; probe++) {
+                unsigned base = group * GROUP_WIDTH;
+                unsigned mask = Group(_ctrl.get() + base).match_available();
+                if (mask) {
+                    return base + find_lsb(mask);
+                }
+                group = (group + probe) & group_mask;
+            }
+        }
+
+        /**
+         * @brief Allocate empty storage for a number of slots.
+         *
+         * @param capacity Power of 2, at least GROUP_WIDTH.
+         */
+        void allocate(unsigned capacity) {
+            _capacity = capacity;
+            _ctrl = std::make_unique<int8_t[]>(capacity);
+            std::memset(_ctrl.get(), CTRL_EMPTY, capacity);
+            _slots = std::allocator<value_type>().allocate(capacity);
+        }
+
+        /**
+         * @brief Destroy all entries and free the storage.
+         *
+         */
+        void deallocate() {
+            for (unsigned i = 0; i < _capacity; i++) {
+                if (_ctrl[i] >= 0) {
+                    _slots[i].~value_type();
+                }
+            }
+            if (_slots) {
+                std::allocator<value_type>().deallocate(_slots, _capacity);
+            }
+            _ctrl.reset();
+            _slots = nullptr;
+            _capacity = 0;
+            _size = 0;
+            _deleted = 0;
+        }
+
+        /**
+         * @brief Rebuild the table with a new capacity, discarding tombstones.
+         *
+         * @param capacity
+         */
+        void rehash(unsigned capacity) {
+            std::unique_ptr<int8_t[]> ctrl = std::move(_ctrl);
+            value_type *slots = _slots;
+            unsigned prev_capacity = _capacity;
+
+            allocate(capacity);
+            _deleted = 0;
+            for (unsigned i = 0; i < prev_capacity; i++) {
+                if (ctrl[i] >= 0) {
+                    uint64_t h = hash(slots[i].first);
+                    unsigned index = find_available(h);
+                    _ctrl[index] = h & 0x7f;
+                    new (_slots + index) value_type(std::move(slots[i]));
+                    slots[i].~value_type();
+                }
+            }
+            if (slots) {
+                std::allocator<value_type>().deallocate(slots, prev_capacity);
+            }
+        }
+
+        /**
+         * @brief Ensure there is room for one more entry, rehashing if the
+         * table would exceed its maximum load factor of 7/8.
+         *
+         */
+        void prepare_insert() {
+            if (_capacity == 0) {
+                allocate(GROUP_WIDTH);
+            } else if ((_size + _deleted + 1) * 8 > _capacity * 7) {
+                // Purge tombstones in-place if they account for most of the load
+                unsigned capacity = (_size + 1) * 16 > _capacity * 7 ? _capacity * 2 : _capacity;
+                rehash(capacity);
+            }
+        }
+
+        /**
+         * @brief Forward iterator over the occupied slots.
+         *
+         * @tparam Const
+         */
+        template <bool Const>
+        class Iterator {
+            using Map = std::conditional_t<Const, const FlatMap, FlatMap>;
+            Map *_map;
+            unsigned _index;
+
+            inline void skip() {
+                while (_index < _map->_capacity && _map->_ctrl[_index] < 0) {
+                    _index++;
+                }
+            }
+
+            template <bool>
+            friend class Iterator;
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename FlatMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+            using reference = std::conditional_t<Const, const value_type &, value_type &>;
+
+            Iterator(Map *map, unsigned index) : _map(map), _index(index) { skip(); }
+
+            template <bool C = Const, typename = std::enable_if_t<C>>
+            Iterator(const Iterator<false> &rhs) : _map(rhs._map), _index(rhs._index) {}
+
+            inline reference operator*() const { return _map->_slots[_index]; }
+
+            inline pointer operator->() const { return _map->_slots + _index; }
+
+            inline Iterator &operator++() {
+                _index++;
+                skip();
+                return *this;
+            }
+
+            inline Iterator operator++(int) {
+                Iterator prev = *this;
+                ++(*this);
+                return prev;
+            }
+
+            inline bool operator==(const Iterator &rhs) const { return _index == rhs._index; }
+
+            inline bool operator!=(const Iterator &rhs) const { return _index != rhs._index; }
+        };
+
+      public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        /**
+         * @brief Construct an empty FlatMap.
+         *
+         */
+        FlatMap() = default;
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param rhs
+         */
+        FlatMap(const FlatMap &rhs) : _hash(rhs._hash), _equal(rhs._equal) {
+            for (const value_type &entry : rhs) {
+                emplace(entry.first, entry.second);
+            }
+        }
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param rhs
+         */
+        FlatMap(FlatMap &&rhs) noexcept :
+            _ctrl(std::move(rhs._ctrl)), _slots(rhs._slots), _capacity(rhs._capacity), _size(rhs._size),
+            _deleted(rhs._deleted), _hash(std::move(rhs._hash)), _equal(std::move(rhs._equal)) {
+            rhs._slots = nullptr;
+            rhs._capacity = 0;
+            rhs._size = 0;
+            rhs._deleted = 0;
+        }
+
+        /**
+         * @brief Destroy the FlatMap.
+         *
+         */
+        ~FlatMap() { deallocate(); }
+
+        /**
+         * @brief Copy assignment.
+         *
+         * @param rhs
+         * @return FlatMap&
+         */
+        FlatMap &operator=(const FlatMap &rhs) {
+            if (this != &rhs) {
+                FlatMap copy(rhs);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment.
+         *
+         * @param rhs
+         * @return FlatMap&
+         */
+        FlatMap &operator=(FlatMap &&rhs) noexcept {
+            if (this != &rhs) {
+                deallocate();
+                _ctrl = std::move(rhs._ctrl);
+                _slots = rhs._slots;
+                _capacity = rhs._capacity;
+                _size = rhs._size;
+                _deleted = rhs._deleted;
+                _hash = std::move(rhs._hash);
+                _equal = std::move(rhs._equal);
+
+                rhs._slots = nullptr;
+                rhs._capacity = 0;
+                rhs._size = 0;
+                rhs._deleted = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Get the number of entries in the map.
+         *
+         * @return unsigned
+         */
+        inline unsigned size() const { return _size; }
+
+        /**
+         * @brief Check if the map is empty.
+         *
+         * @return true
+         * @return false
+         */
+        inline bool empty() const { return _size == 0; }
+
+        /**
+         * @brief Reserve space for at least n entries without rehashing.
+         *
+         * @param n
+         */
+        void reserve(unsigned n) {
+            unsigned capacity = std::max(round_pow2((n * 8 + 6) / 7), GROUP_WIDTH);
+            if (capacity > _capacity) {
+                rehash(capacity);
+            }
+        }
+
+        /**
+         * @brief Find an entry by key.
+         *
+         * @param key
+         * @return iterator
+         */
+        inline iterator find(const K &key) { return iterator(this, lookup(key, hash(key))); }
+
+        /**
+         * @brief Find an entry by key.
+         *
+         * @param key
+         * @return const_iterator
+         */
+        inline const_iterator find(const K &key) const { return const_iterator(this, lookup(key, hash(key))); }
+
+        /**
+         * @brief Count the number of entries with a key (0 or 1).
+         *
+         * @param key
+         * @return unsigned
+         */
+        inline unsigned count(const K &key) const { return lookup(key, hash(key)) != _capacity; }
+
+        /**
+         * @brief Insert an entry if the key does not already exist.
+         *
+         * Returns an iterator to the entry with the key and whether the insertion happened.
+         *
+         * @param key
+         * @param value
+         * @return std::pair<iterator, bool>
+         */
+        template <typename KeyArg, typename... ValueArgs>
+        std::pair<iterator, bool> emplace(KeyArg &&key, ValueArgs &&...value) {
+            uint64_t h = hash(key);
+            unsigned index = lookup(key, h);
+            if (index != _capacity) {
+                return {iterator(this, index), false};
+            }
+
+            prepare_insert();
+            index = find_available(h);
+            _deleted -= _ctrl[index] == CTRL_DELETED;
+            _ctrl[index] = h & 0x7f;
+            new (_slots + index) value_type(std::piecewise_construct,
+                                            std::forward_as_tuple(std::forward<KeyArg>(key)),
+                                            std::forward_as_tuple(std::forward<ValueArgs>(value)...));
+            _size++;
+            return {iterator(this, index), true};
+        }
+
+        /**
+         * @brief Get the value of a key, default constructing it if it does not exist.
+         *
+         * @param key
+         * @return V&
+         */
+        inline V &operator[](const K &key) { return emplace(key).first->second; }
+
+        /**
+         * @brief Get the value of an existing key.
+         *
+         * @param key
+         * @return V&
+         */
+        inline V &at(const K &key) {
+            unsigned index = lookup(key, hash(key));
+            DYN_ASSERT(index != _capacity);
+            return _slots[index].second;
+        }
+
+        /**
+         * @brief Get the value of an existing key.
+         *
+         * @param key
+         * @return const V&
+         */
+        inline const V &at(const K &key) const {
+            unsigned index = lookup(key, hash(key));
+            DYN_ASSERT(index != _capacity);
+            return _slots[index].second;
+        }
+
+        /**
+         * @brief Remove an entry by key, returning the number of entries removed.
+         *
+         * @param key
+         * @return unsigned
+         */
+        unsigned erase(const K &key) {
+            unsigned index = lookup(key, hash(key));
+            if (index == _capacity) return 0;
+
+            _slots[index].~value_type();
+            _size--;
+
+            // Probes stop at any group with an empty slot, so a tombstone is only
+            // needed if this group was completely full
+            unsigned base = index - (index % GROUP_WIDTH);
+            if (Group(_ctrl.get() + base).match_empty()) {
+                _ctrl[index] = CTRL_EMPTY;
+            } else {
+                _ctrl[index] = CTRL_DELETED;
+                _deleted++;
+            }
+            return 1;
+        }
+
+        /**
+         * @brief Remove all entries, retaining the allocated capacity.
+         *
+         */
+        void clear() {
+            for (unsigned i = 0; i < _capacity; i++) {
+                if (_ctrl[i] >= 0) {
+                    _slots[i].~value_type();
+                }
+            }
+            if (_capacity) {
+                std::memset(_ctrl.get(), CTRL_EMPTY, _capacity);
+            }
+            _size = 0;
+            _deleted = 0;
+        }
+
+        inline iterator begin() { return iterator(this, 0); }
+
+        inline iterator end() { return iterator(this, _capacity); }
+
+        inline const_iterator begin() const { return const_iterator(this, 0); }
+
+        inline const_iterator end() const { return const_iterator(this, _capacity); }
+    };
+} // namespace Dynamo
\ No newline at end of file
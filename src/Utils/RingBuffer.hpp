@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 
 #include <Utils/Log.hpp>
 
@@ -13,6 +15,11 @@ namespace Dynamo {
      * The buffer is full if write is just behind read.
      * The buffer is empty if the read and write point to the same index.
      *
+     * A single producer and a single consumer may operate on the buffer
+     * concurrently without locking. The producer owns the write pointer and
+     * the consumer owns the read pointer, each published with release
+     * semantics.
+     *
      * @tparam T Type of element, must be trivially copyable.
      * @tparam N Maximum size of the container (power of 2).
      */
@@ -23,10 +30,21 @@ namespace Dynamo {
         static_assert(std::is_trivially_copyable<T>::value, "RingBuffer element type must be trivially copyable");
 
         std::array<T, N> _buffer;
-        unsigned _read;
-        unsigned _write;
+
+        // Indices are kept on separate cache lines so the producer and consumer do not contend
+        alignas(64) std::atomic<unsigned> _read;
+        alignas(64) std::atomic<unsigned> _write;
 
       public:
+        /**
+         * @brief Contiguous region of the underlying buffer.
+         *
+         */
+        struct Region {
+            T *data;
+            unsigned length;
+        };
+
         /**
          * @brief Construct a new RingBuffer object
          *
@@ -54,7 +72,9 @@ namespace Dynamo {
          *
          * @return unsigned
          */
-        inline unsigned size() const { return (_write - _read); }
+        inline unsigned size() const {
+            return _write.load(std::memory_order_acquire) - _read.load(std::memory_order_acquire);
+        }
 
         /**
          * @brief Get the number of writes that can still be performed
@@ -63,6 +83,74 @@ namespace Dynamo {
          */
         inline unsigned remaining() const { return N - size(); }
 
+        /**
+         * @brief Get up to n contiguous readable regions without advancing
+         * the read pointer
+         *
+         * The second region is non-empty only if the readable data wraps
+         * around the end of the buffer. Consumer only.
+         *
+         * @param n
+         * @return std::array<Region, 2>
+         */
+        inline std::array<Region, 2> acquire_read(const unsigned n) {
+            unsigned read = _read.load(std::memory_order_relaxed);
+            unsigned write = _write.load(std::memory_order_acquire);
+
+            unsigned offset = read & MASK;
+            unsigned length = std::min(n, write - read);
+            unsigned l_length = std::min(length, N - offset);
+
+            T *base = _buffer.data();
+            return {Region{base + offset, l_length}, Region{base, length - l_length}};
+        }
+
+        /**
+         * @brief Release n elements previously acquired for reading,
+         * advancing the read pointer. Consumer only.
+         *
+         * @param n
+         */
+        inline void commit_read(const unsigned n) {
+            unsigned read = _read.load(std::memory_order_relaxed);
+            DYN_ASSERT(n <= _write.load(std::memory_order_acquire) - read);
+            _read.store(read + n, std::memory_order_release);
+        }
+
+        /**
+         * @brief Get up to n contiguous writable regions without advancing
+         * the write pointer
+         *
+         * The second region is non-empty only if the writable space wraps
+         * around the end of the buffer. Producer only.
+         *
+         * @param n
+         * @return std::array<Region, 2>
+         */
+        inline std::array<Region, 2> acquire_write(const unsigned n) {
+            unsigned write = _write.load(std::memory_order_relaxed);
+            unsigned read = _read.load(std::memory_order_acquire);
+
+            unsigned offset = write & MASK;
+            unsigned length = std::min(n, N - (write - read));
+            unsigned l_length = std::min(length, N - offset);
+
+            T *base = _buffer.data();
+            return {Region{base + offset, l_length}, Region{base, length - l_length}};
+        }
+
+        /**
+         * @brief Publish n elements previously acquired for writing,
+         * advancing the write pointer. Producer only.
+         *
+         * @param n
+         */
+        inline void commit_write(const unsigned n) {
+            unsigned write = _write.load(std::memory_order_relaxed);
+            DYN_ASSERT(n <= N - (write - _read.load(std::memory_order_acquire)));
+            _write.store(write + n, std::memory_order_release);
+        }
+
         /**
          * @brief Read a value from the buffer, advancing the read pointer
          *
@@ -70,7 +158,10 @@ namespace Dynamo {
          */
         inline T read() {
             DYN_ASSERT(!empty());
-            return _buffer[_read++ & MASK];
+            unsigned read = _read.load(std::memory_order_relaxed);
+            T value = _buffer[read & MASK];
+            _read.store(read + 1, std::memory_order_release);
+            return value;
         }
 
         /**
@@ -80,7 +171,9 @@ namespace Dynamo {
          */
         inline void write(T value) {
             DYN_ASSERT(!full());
-            _buffer[_write++ & MASK] = value;
+            unsigned write = _write.load(std::memory_order_relaxed);
+            _buffer[write & MASK] = value;
+            _write.store(write + 1, std::memory_order_release);
         }
 
         /**
@@ -94,18 +187,12 @@ namespace Dynamo {
          * @return unsigned
          */
         inline unsigned read(T *dst, const unsigned n) {
-            // Compute copy partitions
-            unsigned offset = _read & MASK;
-            unsigned length = std::min(n, size());
-            unsigned l_length = std::min(length, N - offset);
-            unsigned r_length = length - l_length;
+            std::array<Region, 2> regions = acquire_read(n);
+            std::copy(regions[0].data, regions[0].data + regions[0].length, dst);
+            std::copy(regions[1].data, regions[1].data + regions[1].length, dst + regions[0].length);
 
-            T *src = _buffer.data();
-            std::copy(src + offset, src + offset + l_length, dst);
-            std::copy(src, src + r_length, dst + l_length);
-
-            // Update read pointer
-            _read += length;
+            unsigned length = regions[0].length + regions[1].length;
+            commit_read(length);
             return length;
         }
 
@@ -120,36 +207,36 @@ namespace Dynamo {
          * @return unsigned
          */
         inline unsigned write(const T *src, const unsigned n) {
-            // Compute copy partitions
-            unsigned offset = _write & MASK;
-            unsigned length = std::min(n, remaining());
-            unsigned l_length = std::min(length, N - offset);
-
-            T *dst = _buffer.data();
-            std::copy(src, src + l_length, dst + offset);
-            std::copy(src + l_length, src + length, dst);
+            std::array<Region, 2> regions = acquire_write(n);
+            std::copy(src, src + regions[0].length, regions[0].data);
+            std::copy(src + regions[0].length, src + regions[0].length + regions[1].length, regions[1].data);
 
-            // Update write pointer
-            _write += length;
+            unsigned length = regions[0].length + regions[1].length;
+            commit_write(length);
             return length;
         }
 
         /**
          * @brief Pop a value from the buffer, shifting back the write pointer
          *
+         * This must not race with a consumer that may read the popped value.
+         *
          */
         inline void pop() {
             DYN_ASSERT(!empty());
-            _write--;
+            _write.fetch_sub(1, std::memory_order_acq_rel);
         }
 
         /**
          * @brief Empty the buffer
          *
+         * This is not safe to call while the buffer is in use by another
+         * thread.
+         *
          */
         inline void clear() {
-            _read = 0;
-            _write = 0;
+            _read.store(0, std::memory_order_relaxed);
+            _write.store(0, std::memory_order_release);
         }
     };
 } // namespace Dynamo
\ No newline at end of file
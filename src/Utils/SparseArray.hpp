@@ -12,6 +12,10 @@ namespace Dynamo {
     /**
      * @brief Data structure that allows O(1) insertion, removal, and access of a value by a unique handle identifier.
      *
+     * Values are densely packed so that iteration is proportional to the number of live entries. Handles encode
+     * a slot index in the lower bits and a generation counter in the upper bits, so a handle to a removed entry
+     * will not alias a newer entry that reuses its slot.
+     *
      * @tparam Id
      * @tparam T
      */
@@ -20,10 +24,35 @@ namespace Dynamo {
         static_assert(std::is_pointer<Id>::value, "Id must be a valid handle type (opaque pointer).");
         static_assert(sizeof(Id) == sizeof(uintptr_t), "Id and its integer mode must be the same size.");
 
-        std::vector<T> _entries;
-        std::vector<uint8_t> _set_flags;
+        static constexpr unsigned INDEX_BITS = sizeof(uintptr_t) * 4;
+        static constexpr uintptr_t INDEX_MASK = (static_cast<uintptr_t>(1) << INDEX_BITS) - 1;
+        static constexpr uintptr_t NULL_INDEX = INDEX_MASK;
+
+        struct Slot {
+            uintptr_t dense;
+            uintptr_t generation;
+        };
+
+        std::vector<T> _dense;
+        std::vector<uintptr_t> _keys;
+        std::vector<Slot> _sparse;
         std::vector<uintptr_t> _recycle;
-        unsigned _size = 0;
+
+        /**
+         * @brief Find the dense index of a handle, returning NULL_INDEX if it is invalid or stale.
+         *
+         * @param id
+         * @return uintptr_t
+         */
+        inline uintptr_t lookup(Id id) const {
+            uintptr_t handle = reinterpret_cast<uintptr_t>(id);
+            uintptr_t key = handle & INDEX_MASK;
+            uintptr_t generation = handle >> INDEX_BITS;
+            if (key >= _sparse.size() || _sparse[key].generation != generation) {
+                return NULL_INDEX;
+            }
+            return _sparse[key].dense;
+        }
 
       public:
         /**
@@ -31,7 +60,7 @@ namespace Dynamo {
          *
          * @return unsigned
          */
-        unsigned size() const { return _size; }
+        unsigned size() const { return _dense.size(); }
 
         /**
          * @brief Check if the container is empty.
@@ -39,7 +68,7 @@ namespace Dynamo {
          * @return true
          * @return false
          */
-        bool empty() const { return _size == 0; }
+        bool empty() const { return _dense.empty(); }
 
         /**
          * @brief Insert a value into the set and return its id.
@@ -48,31 +77,49 @@ namespace Dynamo {
          * @return Id
          */
         Id insert(const T &value) {
-            _size++;
+            uintptr_t key;
             if (_recycle.empty()) {
-                _entries.push_back(value);
-                _set_flags.push_back(1);
-                return reinterpret_cast<Id>(_entries.size() - 1);
+                key = _sparse.size();
+                DYN_ASSERT(key < NULL_INDEX);
+                _sparse.push_back({0, 0});
             } else {
-                uintptr_t key = _recycle.back();
+                key = _recycle.back();
                 _recycle.pop_back();
-
-                _entries[key] = value;
-                _set_flags[key] = 1;
-                return reinterpret_cast<Id>(key);
             }
+
+            Slot &slot = _sparse[key];
+            slot.dense = _dense.size();
+            _dense.push_back(value);
+            _keys.push_back(key);
+
+            return reinterpret_cast<Id>(key | (slot.generation << INDEX_BITS));
         }
 
         /**
          * @brief Remove an element from the set.
          *
+         * The last element is moved into the vacated position to keep the values contiguous.
+         *
          * @param id
          */
         void remove(Id id) {
-            uintptr_t key = reinterpret_cast<uintptr_t>(id);
-            DYN_ASSERT(key < _entries.size() && _set_flags[key]);
-            _size--;
-            _set_flags[key] = 0;
+            uintptr_t index = lookup(id);
+            DYN_ASSERT(index != NULL_INDEX);
+            uintptr_t key = reinterpret_cast<uintptr_t>(id) & INDEX_MASK;
+
+            // Swap the last element into the vacated position
+            uintptr_t back_key = _keys.back();
+            _dense[index] = std::move(_dense.back());
+            _keys[index] = back_key;
+            _sparse[back_key].dense = index;
+
+            _dense.pop_back();
+            _keys.pop_back();
+
+            // Invalidate outstanding handles to this slot
+            Slot &slot = _sparse[key];
+            slot.dense = NULL_INDEX;
+            slot.generation = (slot.generation + 1) & INDEX_MASK;
             _recycle.push_back(key);
         }
 
@@ -83,9 +130,9 @@ namespace Dynamo {
          * @return T&
          */
         T &get(Id id) {
-            uintptr_t key = reinterpret_cast<uintptr_t>(id);
-            DYN_ASSERT(key < _entries.size() && _set_flags[key]);
-            return _entries[key];
+            uintptr_t index = lookup(id);
+            DYN_ASSERT(index != NULL_INDEX);
+            return _dense[index];
         }
 
         /**
@@ -95,22 +142,21 @@ namespace Dynamo {
          * @return T&
          */
         const T &get(Id id) const {
-            uintptr_t key = reinterpret_cast<uintptr_t>(id);
-            DYN_ASSERT(key < _entries.size() && _set_flags[key]);
-            return _entries[key];
+            uintptr_t index = lookup(id);
+            DYN_ASSERT(index != NULL_INDEX);
+            return _dense[index];
         }
 
         /**
          * @brief Check if an entry exists in the array.
          *
+         * This returns false for stale handles whose slot has since been reused.
+         *
          * @param id
          * @return true
          * @return false
          */
-        bool exists(Id id) const {
-            uintptr_t key = reinterpret_cast<uintptr_t>(id);
-            return key < _entries.size() && _set_flags[key];
-        }
+        bool exists(Id id) const { return lookup(id) != NULL_INDEX; }
 
         /**
          * @brief Iterate over each element in the set.
@@ -120,10 +166,8 @@ namespace Dynamo {
          */
         template <typename Functor>
         void foreach (Functor &&function) {
-            for (uintptr_t i = 0; i < _entries.size(); i++) {
-                if (_set_flags[i]) {
-                    function(_entries[i]);
-                }
+            for (T &value : _dense) {
+                function(value);
             }
         }
 
@@ -132,10 +176,17 @@ namespace Dynamo {
          *
          */
         void clear() {
-            _size = 0;
-            _entries.clear();
+            _dense.clear();
+            _keys.clear();
             _recycle.clear();
-            _set_flags.clear();
+
+            // Retain the slots so that their generations invalidate previous handles
+            for (uintptr_t key = _sparse.size(); key-- > 0;) {
+                Slot &slot = _sparse[key];
+                slot.dense = NULL_INDEX;
+                slot.generation = (slot.generation + 1) & INDEX_MASK;
+                _recycle.push_back(key);
+            }
         }
     };
 } // namespace Dynamo
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include <memory>
+#include <mutex>
+
+#include <Utils/FlatMap.hpp>
+#include <Utils/Log.hpp>
+#include <Utils/StringId.hpp>
+
+namespace Dynamo {
+    /**
+     * @brief Global table of interned strings.
+     *
+     * Each string is allocated separately so that references returned by
+     * str() survive the map rehashing on later insertions.
+     *
+     */
+    struct InternTable {
+        std::mutex mutex;
+        FlatMap<StringId, std::unique_ptr<std::string>> strings;
+    };
+
+    static InternTable &intern_table() {
+        static InternTable table;
+        return table;
+    }
+
+    StringId StringId::intern(std::string_view str) {
+        StringId id(str);
+        InternTable &table = intern_table();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.strings.find(id);
+        if (it == table.strings.end()) {
+            table.strings.emplace(id, std::make_unique<std::string>(str));
+        } else if (*it->second != str) {
+            Log::error("StringId collision between '{}' and '{}'", *it->second, std::string(str));
+        }
+        return id;
+    }
+
+    const std::string &StringId::str() const {
+        static const std::string empty;
+        InternTable &table = intern_table();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.strings.find(*this);
+        return it == table.strings.end() ? empty : *it->second;
+    }
+} // namespace Dynamo
\ No newline at end of file
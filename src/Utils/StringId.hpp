@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Dynamo {
+    /**
+     * @brief Stable 64-bit identifier for a name string.
+     *
+     * The identifier is the FNV-1a hash of the string, so it is the same across runs and can
+     * be computed at compile-time for literals. Comparing and hashing identifiers avoids string
+     * comparisons and allocations on hot lookup paths.
+     *
+     * Strings passed to intern() are recorded so that the original name can be recovered and
+     * hash collisions between distinct names are reported.
+     *
+     */
+    class StringId {
+        static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325;
+        static constexpr uint64_t FNV_PRIME = 0x100000001b3;
+
+        uint64_t _value;
+
+      public:
+        /**
+         * @brief Construct the null identifier.
+         *
+         */
+        constexpr StringId() : _value(0) {}
+
+        /**
+         * @brief Construct an identifier from a string.
+         *
+         * @param str
+         */
+        constexpr StringId(std::string_view str) : _value(FNV_OFFSET) {
+            for (char c : str) {
+                _value ^= static_cast<unsigned char>(c);
+                _value *= FNV_PRIME;
+            }
+        }
+
+        /**
+         * @brief Construct an identifier from a null-terminated string.
+         *
+         * @param str
+         */
+        constexpr StringId(const char *str) : StringId(std::string_view(str)) {}
+
+        /**
+         * @brief Construct an identifier from a string.
+         *
+         * @param str
+         */
+        StringId(const std::string &str) : StringId(std::string_view(str)) {}
+
+        /**
+         * @brief Get the identifier of a string and record it in the intern table.
+         *
+         * This will throw an error if a different string with the same identifier was
+         * previously interned.
+         *
+         * @param str
+         * @return StringId
+         */
+        static StringId intern(std::string_view str);
+
+        /**
+         * @brief Get the interned string of this identifier.
+         *
+         * Returns an empty string if the identifier was never interned. The
+         * reference stays valid for the lifetime of the program.
+         *
+         * @return const std::string&
+         */
+        const std::string &str() const;
+
+        /**
+         * @brief Get the integer value of the identifier.
+         *
+         * @return uint64_t
+         */
+        constexpr uint64_t value() const { return _value; }
+
+        constexpr bool operator==(const StringId &other) const { return _value == other._value; }
+
+        constexpr bool operator!=(const StringId &other) const { return _value != other._value; }
+    };
+
+    /**
+     * @brief Compile-time string identifier literal.
+     *
+     * @param str
+     * @param length
+     * @return StringId
+     */
+    constexpr StringId operator""_sid(const char *str, size_t length) { return StringId(std::string_view(str, length)); }
+} // namespace Dynamo
+
+template <>
+struct std::hash<Dynamo::StringId> {
+    inline size_t operator()(const Dynamo::StringId &id) const { return id.value(); }
+};
\ No newline at end of file
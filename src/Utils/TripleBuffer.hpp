@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace Dynamo {
+    /**
+     * @brief Lock-free snapshot exchange between a single writer and a
+     * single reader.
+     *
+     * The writer fills the back buffer and publishes it, and the reader
+     * acquires the most recently published buffer. Neither side blocks, and
+     * the reader never observes a partially written snapshot.
+     *
+     * The back buffer holds stale data after publishing, so the writer
+     * should rewrite the whole snapshot each time.
+     *
+     * @tparam T Type of snapshot.
+     */
+    template <typename T>
+    class TripleBuffer {
+        static constexpr unsigned DIRTY = 4;
+        static constexpr unsigned INDEX_MASK = DIRTY - 1;
+
+        std::array<T, 3> _buffers;
+
+        alignas(64) std::atomic<unsigned> _middle;
+        alignas(64) unsigned _back;
+        alignas(64) unsigned _front;
+
+      public:
+        /**
+         * @brief Construct a new TripleBuffer object.
+         *
+         */
+        TripleBuffer() : _middle(1), _back(0), _front(2) {}
+
+        /**
+         * @brief Get the buffer to be written by the writer.
+         *
+         * @return T&
+         */
+        inline T &back() { return _buffers[_back]; }
+
+        /**
+         * @brief Publish the back buffer to the reader.
+         *
+         */
+        inline void publish() { _back = _middle.exchange(_back | DIRTY, std::memory_order_acq_rel) & INDEX_MASK; }
+
+        /**
+         * @brief Swap in the latest published buffer, returning true if
+         * there was a new one.
+         *
+         * @return true
+         * @return false
+         */
+        inline bool acquire() {
+            if ((_middle.load(std::memory_order_relaxed) & DIRTY) == 0) {
+                return false;
+            }
+            _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX_MASK;
+            return true;
+        }
+
+        /**
+         * @brief Get the buffer last acquired by the reader.
+         *
+         * The reader may write to it, e.g., to use scratch space allocated
+         * by the writer, since the writer does not touch it until the next
+         * acquire.
+         *
+         * @return T&
+         */
+        inline T &front() { return _buffers[_front]; }
+
+        /**
+         * @brief Get the buffer last acquired by the reader.
+         *
+         * @return const T&
+         */
+        inline const T &front() const { return _buffers[_front]; }
+    };
+} // namespace Dynamo
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Create a test signal of N frames.
+ *
+ * @param N
+ * @param phase
+ * @return std::vector<float>
+ */
+static std::vector<float> test_signal(unsigned N, float phase) {
+    std::vector<float> signal(N);
+    for (unsigned i = 0; i < N; i++) {
+        signal[i] = std::sin(i * 0.7f + phase) + 0.25f * std::cos(i * 2.1f) + 0.1f;
+    }
+    return signal;
+}
+
+/**
+ * @brief Naive discrete fourier transform of a complex signal, computed in double precision.
+ *
+ * @param re
+ * @param im
+ * @param dst_re
+ * @param dst_im
+ */
+static void dft(const std::vector<float> &re,
+                const std::vector<float> &im,
+                std::vector<float> &dst_re,
+                std::vector<float> &dst_im) {
+    unsigned N = re.size();
+    dst_re.resize(N);
+    dst_im.resize(N);
+    for (unsigned k = 0; k < N; k++) {
+        double sum_re = 0;
+        double sum_im = 0;
+        for (unsigned n = 0; n < N; n++) {
+            double angle = -2 * M_PI * ((k * n) % N) / N;
+            sum_re += re[n] * std::cos(angle) - im[n] * std::sin(angle);
+            sum_im += re[n] * std::sin(angle) + im[n] * std::cos(angle);
+        }
+        dst_re[k] = sum_re;
+        dst_im[k] = sum_im;
+    }
+}
+
+TEST_CASE("FFTPlan transform", "[FFTPlan]") {
+    // Both odd and even powers of 2 are computed differently
+    for (unsigned N = 4; N <= 1024; N *= 2) {
+        Dynamo::FFTPlan plan(N);
+        REQUIRE(plan.size() == N);
+
+        std::vector<float> re = test_signal(N, 0);
+        std::vector<float> im = test_signal(N, 1);
+
+        // Matches a naive discrete fourier transform
+        std::vector<float> expected_re;
+        std::vector<float> expected_im;
+        dft(re, im, expected_re, expected_im);
+
+        std::vector<float> spectrum_re = re;
+        std::vector<float> spectrum_im = im;
+        plan.forward(spectrum_re.data(), spectrum_im.data());
+        for (unsigned k = 0; k < N; k++) {
+            REQUIRE_THAT(spectrum_re[k], Approx(expected_re[k], 1e-3));
+            REQUIRE_THAT(spectrum_im[k], Approx(expected_im[k], 1e-3));
+        }
+
+        // Round trip
+        plan.inverse(spectrum_re.data(), spectrum_im.data());
+        for (unsigned i = 0; i < N; i++) {
+            REQUIRE_THAT(spectrum_re[i], Approx(re[i], 1e-5));
+            REQUIRE_THAT(spectrum_im[i], Approx(im[i], 1e-5));
+        }
+    }
+}
+
+TEST_CASE("FFTPlan real transform", "[FFTPlan]") {
+    for (unsigned N = 4; N <= 1024; N *= 2) {
+        Dynamo::FFTPlan plan(N);
+        std::vector<float> signal = test_signal(N, 0);
+
+        // Matches the non-redundant half of the complex transform
+        std::vector<float> expected_re;
+        std::vector<float> expected_im;
+        dft(signal, std::vector<float>(N, 0), expected_re, expected_im);
+
+        std::vector<float> re(N / 2 + 1);
+        std::vector<float> im(N / 2 + 1);
+        plan.forward_real(signal.data(), re.data(), im.data());
+        for (unsigned k = 0; k <= N / 2; k++) {
+            REQUIRE_THAT(re[k], Approx(expected_re[k], 1e-3));
+            REQUIRE_THAT(im[k], Approx(expected_im[k], 1e-3));
+        }
+
+        // Round trip
+        std::vector<float> result(N);
+        plan.inverse_real(re.data(), im.data(), result.data());
+        for (unsigned i = 0; i < N; i++) {
+            REQUIRE_THAT(result[i], Approx(signal[i], 1e-5));
+        }
+    }
+}
+
+TEST_CASE("FFTPlan benchmarks", "[FFTPlan]") {
+    constexpr unsigned N = 512;
+    Dynamo::FFTPlan plan(N);
+    std::vector<float> signal = test_signal(N, 0);
+    std::vector<float> re(N / 2 + 1);
+    std::vector<float> im(N / 2 + 1);
+
+    BENCHMARK("FFTPlan real transform") {
+        plan.forward_real(signal.data(), re.data(), im.data());
+        plan.inverse_real(re.data(), im.data(), signal.data());
+    };
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <Dynamo.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "../Common.hpp"
+
 TEST_CASE("Vectorize Instruction Set", "[Vectorize]") {
 #if defined(DYNAMO_ARCH_NEON)
     Dynamo::Log::info("Vectorize Neon");
@@ -12,3 +14,250 @@ TEST_CASE("Vectorize Instruction Set", "[Vectorize]") {
     Dynamo::Log::info("Vectorize SIMD not available");
 #endif
 }
+
+
+TEST_CASE("Vectorize vdot", "[Vectorize]") {
+    float a[37];
+    float b[37];
+    for (unsigned i = 0; i < 37; i++) {
+        a[i] = i;
+        b[i] = 2;
+    }
+
+    // Cover the vector body and each remainder length
+    for (unsigned length = 0; length <= 37; length++) {
+        REQUIRE(Dynamo::Vectorize::vdot(a, b, length) == static_cast<float>(length * (length - 1)));
+    }
+}
+
+TEST_CASE("Vectorize vcma", "[Vectorize]") {
+    float a_re[37], a_im[37], b_re[37], b_im[37];
+    for (unsigned i = 0; i < 37; i++) {
+        a_re[i] = i;
+        a_im[i] = 1;
+        b_re[i] = 2;
+        b_im[i] = -3;
+    }
+
+    // Cover the vector body and each remainder length
+    for (unsigned length = 0; length <= 37; length++) {
+        float dst_re[37], dst_im[37];
+        std::fill(dst_re, dst_re + 37, 1);
+        std::fill(dst_im, dst_im + 37, 2);
+        Dynamo::Vectorize::vcma(a_re, a_im, b_re, b_im, dst_re, dst_im, length);
+        for (unsigned i = 0; i < 37; i++) {
+            float re = i < length ? 1 + 2.0f * i + 3 : 1;
+            float im = i < length ? 2 - 3.0f * i + 2 : 2;
+            REQUIRE(dst_re[i] == re);
+            REQUIRE(dst_im[i] == im);
+        }
+    }
+}
+
+TEST_CASE("Vectorize vconvert_s16", "[Vectorize]") {
+    int16_t src[37];
+    for (unsigned i = 0; i < 37; i++) {
+        src[i] = (i % 2 ? -1 : 1) * static_cast<int>(i * 885);
+    }
+
+    // Cover the vector body and each remainder length
+    for (unsigned length = 0; length <= 37; length++) {
+        float dst[37];
+        std::fill(dst, dst + 37, 7);
+        Dynamo::Vectorize::vconvert_s16(src, 0.5, dst, length);
+        for (unsigned i = 0; i < 37; i++) {
+            REQUIRE(dst[i] == (i < length ? src[i] * 0.5f : 7));
+        }
+    }
+}
+
+TEST_CASE("Vectorize vconvert_s24 vconvert_s32", "[Vectorize]") {
+    int32_t values[37];
+    uint8_t packed[37 * 3];
+    for (unsigned i = 0; i < 37; i++) {
+        values[i] = (i % 2 ? -1 : 1) * static_cast<int>(i * 226719);
+        packed[3 * i] = values[i] & 0xff;
+        packed[3 * i + 1] = (values[i] >> 8) & 0xff;
+        packed[3 * i + 2] = (values[i] >> 16) & 0xff;
+    }
+
+    // Cover the vector body and each remainder length
+    for (unsigned length = 0; length <= 37; length++) {
+        float dst_s24[37];
+        float dst_s32[37];
+        std::fill(dst_s24, dst_s24 + 37, 7);
+        std::fill(dst_s32, dst_s32 + 37, 7);
+        Dynamo::Vectorize::vconvert_s24(packed, 0.5, dst_s24, length);
+        Dynamo::Vectorize::vconvert_s32(values, 0.5, dst_s32, length);
+        for (unsigned i = 0; i < 37; i++) {
+            REQUIRE(dst_s24[i] == (i < length ? values[i] * 0.5f : 7));
+            REQUIRE(dst_s32[i] == (i < length ? values[i] * 0.5f : 7));
+        }
+    }
+}
+
+TEST_CASE("Vectorize vquantize", "[Vectorize]") {
+    float src[37];
+    float dither[37];
+    for (unsigned i = 0; i < 37; i++) {
+        src[i] = (i % 2 ? -1.0f : 1.0f) * i / 15.0f;
+        dither[i] = 0.25f;
+    }
+
+    // Samples are rounded to the nearest even integer and saturated past full scale
+    auto expected = [](float sample, float lo, float hi) {
+        return static_cast<int64_t>(std::nearbyint(std::clamp(sample, lo, hi)));
+    };
+    for (unsigned length = 0; length <= 37; length++) {
+        int16_t dst_s16[37];
+        uint8_t dst_s24[37 * 3];
+        int32_t dst_s32[37];
+        std::fill(dst_s16, dst_s16 + 37, 7);
+        std::fill(dst_s24, dst_s24 + 37 * 3, 7);
+        std::fill(dst_s32, dst_s32 + 37, 7);
+        Dynamo::Vectorize::vquantize_s16(src, 32768, nullptr, dst_s16, length);
+        Dynamo::Vectorize::vquantize_s24(src, 8388608, dither, dst_s24, length);
+        Dynamo::Vectorize::vquantize_s32(src, 2147483648.0f, nullptr, dst_s32, length);
+        for (unsigned i = 0; i < 37; i++) {
+            uint32_t bits = dst_s24[3 * i] | (dst_s24[3 * i + 1] << 8) | (dst_s24[3 * i + 2] << 16);
+            int32_t s24 = static_cast<int32_t>(bits << 8) >> 8;
+            if (i < length) {
+                REQUIRE(dst_s16[i] == expected(src[i] * 32768, -32768, 32767));
+                REQUIRE(s24 == expected(src[i] * 8388608 + 0.25f, -8388608, 8388607));
+                REQUIRE(dst_s32[i] == expected(src[i] * 2147483648.0f, -2147483648.0f, 2147483520.0f));
+            } else {
+                REQUIRE(dst_s16[i] == 7);
+                REQUIRE(dst_s24[3 * i] == 7);
+                REQUIRE(dst_s32[i] == 7);
+            }
+        }
+    }
+}
+
+TEST_CASE("Vectorize vinterleave vdeinterleave", "[Vectorize]") {
+    constexpr unsigned stride = 40;
+    float planar[6 * stride];
+    for (unsigned i = 0; i < 6 * stride; i++) {
+        planar[i] = i;
+    }
+
+    // Cover each specialized channel count, the generic path, and each remainder length
+    for (unsigned channels = 1; channels <= 6; channels++) {
+        for (unsigned length = 0; length <= 37; length++) {
+            float interleaved[6 * 37];
+            std::fill(interleaved, interleaved + 6 * 37, -1);
+            Dynamo::Vectorize::vinterleave(planar, stride, channels, interleaved, length);
+            for (unsigned i = 0; i < 6 * 37; i++) {
+                float expected = i < length * channels ? planar[(i % channels) * stride + i / channels] : -1;
+                REQUIRE(interleaved[i] == expected);
+            }
+
+            float deinterleaved[6 * stride];
+            std::fill(deinterleaved, deinterleaved + 6 * stride, -1);
+            Dynamo::Vectorize::vdeinterleave(interleaved, channels, deinterleaved, stride, length);
+            for (unsigned c = 0; c < 6; c++) {
+                for (unsigned f = 0; f < stride; f++) {
+                    float expected = c < channels && f < length ? planar[c * stride + f] : -1;
+                    REQUIRE(deinterleaved[c * stride + f] == expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Vectorize vradix4", "[Vectorize]") {
+    constexpr unsigned stride = 37;
+    float src_re[4 * stride], src_im[4 * stride], twiddles[6 * stride];
+    for (unsigned i = 0; i < 4 * stride; i++) {
+        src_re[i] = std::sin(i * 0.3f);
+        src_im[i] = std::cos(i * 0.7f);
+    }
+    for (unsigned i = 0; i < 6 * stride; i++) {
+        twiddles[i] = std::cos(i * 1.1f);
+    }
+
+    // Cover the vector body and each remainder length
+    for (unsigned length = 0; length <= stride; length++) {
+        float re[4 * stride], im[4 * stride];
+        std::copy(src_re, src_re + 4 * stride, re);
+        std::copy(src_im, src_im + 4 * stride, im);
+        Dynamo::Vectorize::vradix4(re, im, twiddles, stride, length);
+        for (unsigned j = 0; j < stride; j++) {
+            Dynamo::Complex x[4];
+            for (unsigned q = 0; q < 4; q++) {
+                x[q] = Dynamo::Complex(src_re[q * stride + j], src_im[q * stride + j]);
+            }
+            if (j < length) {
+                // Twiddle b, c, and d, then combine the two radix-2 butterflies
+                for (unsigned t = 0; t < 3; t++) {
+                    x[t + 1] *= Dynamo::Complex(twiddles[2 * t * stride + j], twiddles[(2 * t + 1) * stride + j]);
+                }
+                Dynamo::Complex t0 = x[0] + x[1], t1 = x[0] - x[1];
+                Dynamo::Complex t2 = x[2] + x[3], t3 = x[2] - x[3];
+                x[0] = t0 + t2;
+                x[1] = t1 + Dynamo::Complex(t3.im, -t3.re);
+                x[2] = t0 - t2;
+                x[3] = t1 - Dynamo::Complex(t3.im, -t3.re);
+            }
+            for (unsigned q = 0; q < 4; q++) {
+                REQUIRE_THAT(re[q * stride + j], Approx(x[q].re, 1e-5));
+                REQUIRE_THAT(im[q * stride + j], Approx(x[q].im, 1e-5));
+            }
+        }
+    }
+}
+
+TEST_CASE("Vectorize vbiquad", "[Vectorize]") {
+    constexpr unsigned lanes = Dynamo::Vectorize::BIQUAD_LANES;
+    constexpr unsigned length = 64;
+    constexpr unsigned sections = 2;
+
+    // Each lane and section has its own stable coefficients
+    float coefficients[sections * 5 * lanes];
+    float state[sections * 2 * lanes] = {0};
+    for (unsigned s = 0; s < sections; s++) {
+        for (unsigned l = 0; l < lanes; l++) {
+            float *c = coefficients + s * 5 * lanes + l;
+            c[0] = 0.2f + 0.01f * l;
+            c[lanes] = 0.1f * s;
+            c[2 * lanes] = -0.05f;
+            c[3 * lanes] = -0.5f + 0.02f * l;
+            c[4 * lanes] = 0.25f;
+        }
+    }
+
+    float src[length * lanes], dst[length * lanes];
+    for (unsigned i = 0; i < length * lanes; i++) {
+        src[i] = ((i * 7) % 11) / 11.0f - 0.5f;
+    }
+
+    float expected[length * lanes];
+    std::copy(src, src + length * lanes, expected);
+    for (unsigned s = 0; s < sections; s++) {
+        for (unsigned l = 0; l < lanes; l++) {
+            const float *c = coefficients + s * 5 * lanes + l;
+            double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+            for (unsigned i = 0; i < length; i++) {
+                double x = expected[i * lanes + l];
+                double y = c[0] * x + c[lanes] * x1 + c[2 * lanes] * x2 - c[3 * lanes] * y1 - c[4 * lanes] * y2;
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                expected[i * lanes + l] = y;
+            }
+        }
+    }
+
+    Dynamo::Vectorize::vbiquad(src, dst, length, coefficients, nullptr, state, sections);
+    for (unsigned i = 0; i < length * lanes; i++) {
+        REQUIRE_THAT(dst[i], Approx(expected[i], 1e-5));
+    }
+
+    // Interpolated coefficients advance by one increment per sample
+    float deltas[sections * 5 * lanes];
+    std::fill(deltas, deltas + sections * 5 * lanes, 0.001f);
+    float start = coefficients[0];
+    Dynamo::Vectorize::vbiquad(src, dst, length, coefficients, deltas, state, sections);
+    REQUIRE_THAT(coefficients[0], Approx(start + length * 0.001f, 1e-5));
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+TEST_CASE("Ambisonics gains", "[Ambisonics]") {
+    float gains[Dynamo::Sound::ambisonic_channels(3)];
+
+    // Straight ahead of the listener only reaches the front-facing channels
+    Dynamo::Sound::ambisonic_gains(Dynamo::Sound::to_ambisonic(Dynamo::Vec3(0, 0, 2)), 1, gains);
+    REQUIRE_THAT(gains[0], Approx(1, 1e-6));
+    REQUIRE_THAT(gains[1], Approx(0, 1e-6));
+    REQUIRE_THAT(gains[2], Approx(0, 1e-6));
+    REQUIRE_THAT(gains[3], Approx(1, 1e-6));
+
+    // A zero direction is omnidirectional
+    Dynamo::Sound::ambisonic_gains(Dynamo::Vec3(), 3, gains);
+    REQUIRE(gains[0] == 1);
+    for (unsigned c = 1; c < Dynamo::Sound::ambisonic_channels(3); c++) {
+        REQUIRE(gains[c] == 0);
+    }
+}
+
+TEST_CASE("Ambisonics rotation", "[Ambisonics]") {
+    constexpr unsigned order = 3;
+    constexpr unsigned channels = Dynamo::Sound::ambisonic_channels(order);
+    Dynamo::Sound::AmbisonicRotation rotation(order);
+    float matrix[channels * channels];
+
+    // The identity orientation leaves the signal unchanged
+    rotation.compute(Dynamo::Quaternion(), matrix);
+    for (unsigned row = 0; row < channels; row++) {
+        for (unsigned col = 0; col < channels; col++) {
+            REQUIRE_THAT(matrix[row * channels + col], Approx(row == col, 1e-4));
+        }
+    }
+
+    // Rotating an encoded direction matches encoding the direction relative to the listener
+    Dynamo::Quaternion orientation(Dynamo::Vec3(1, 2, -0.5) / Dynamo::Vec3(1, 2, -0.5).length(), 1.1);
+    rotation.compute(orientation, matrix);
+
+    Dynamo::Vec3 direction(0.3, -0.8, 0.5);
+    Dynamo::Vec3 relative(direction * orientation.right(), direction * orientation.up(), direction * orientation.forward());
+    float world[channels], expected[channels];
+    Dynamo::Sound::ambisonic_gains(Dynamo::Sound::to_ambisonic(direction), order, world);
+    Dynamo::Sound::ambisonic_gains(Dynamo::Sound::to_ambisonic(relative), order, expected);
+    for (unsigned row = 0; row < channels; row++) {
+        float sum = 0;
+        for (unsigned col = 0; col < channels; col++) {
+            sum += matrix[row * channels + col] * world[col];
+        }
+        REQUIRE_THAT(sum, Approx(expected[row], 1e-4));
+    }
+}
+
+/**
+ * @brief Energy of a channel.
+ *
+ */
+static float energy(const Dynamo::Sound::Buffer &buffer, unsigned channel) {
+    float sum = 0;
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        sum += buffer[channel][f] * buffer[channel][f];
+    }
+    return sum;
+}
+
+TEST_CASE("Ambisonics bus", "[Ambisonics]") {
+    Dynamo::Sound::Buffer buffer(8192, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.1 * std::sin(0.05f * f);
+    }
+
+    Dynamo::Sound::Jukebox jukebox(2, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::AmbisonicDecoder decoder(1);
+    Dynamo::Sound::Bus bus(decoder, Dynamo::Sound::ambisonic_channels(1));
+    jukebox.add_bus(bus);
+
+    // Sources on the right of the listener
+    std::vector<std::unique_ptr<Dynamo::Sound::AmbisonicEncoder>> encoders;
+    std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+    for (unsigned i = 0; i < 4; i++) {
+        encoders.emplace_back(new Dynamo::Sound::AmbisonicEncoder(1));
+        sources.emplace_back(new Dynamo::Sound::Source(buffer, *encoders.back()));
+        sources.back()->position = Dynamo::Vec3(5, 0, i);
+        sources.back()->set_output(bus);
+        jukebox.play(*sources.back());
+    }
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(2048, dst);
+    REQUIRE(energy(dst, 1) > 2 * energy(dst, 0));
+
+    // Turning around puts them on the left
+    jukebox.listener().rotation = Dynamo::Quaternion(Dynamo::Vec3(0, 1, 0), M_PI);
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    jukebox.render(2048, dst);
+    REQUIRE(energy(dst, 0) > 2 * energy(dst, 1));
+}
\ No newline at end of file
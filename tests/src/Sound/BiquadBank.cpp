@@ -0,0 +1,103 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Root-mean-square of the second half of a channel, after the filter has settled.
+ *
+ */
+static float settled_rms(const Dynamo::Sound::Buffer &buffer, unsigned channel) {
+    float sum = 0;
+    for (unsigned f = buffer.frames() / 2; f < buffer.frames(); f++) {
+        sum += buffer[channel][f] * buffer[channel][f];
+    }
+    return std::sqrt(sum / (buffer.frames() - buffer.frames() / 2));
+}
+
+TEST_CASE("BiquadBank lowpass", "[BiquadBank]") {
+    // Span more than one group of lanes, alternating low and high tones
+    unsigned channels = Dynamo::Vectorize::BIQUAD_LANES + 1;
+    Dynamo::Sound::Buffer buffer(44100, channels);
+    for (unsigned c = 0; c < channels; c++) {
+        float frequency = c % 2 ? 15000 : 100;
+        for (unsigned f = 0; f < buffer.frames(); f++) {
+            buffer[c][f] = std::sin(2 * M_PI * frequency * f / Dynamo::Sound::STANDARD_SAMPLE_RATE);
+        }
+    }
+
+    Dynamo::Sound::BiquadBank bank(channels, 2);
+    bank.set(0, Dynamo::Sound::BiquadCoefficients::lowpass(1000));
+    bank.set(1, Dynamo::Sound::BiquadCoefficients::lowpass(1000));
+    bank.process(buffer, buffer);
+
+    for (unsigned c = 0; c < channels; c++) {
+        if (c % 2) {
+            REQUIRE(settled_rms(buffer, c) < 0.01);
+        } else {
+            REQUIRE_THAT(settled_rms(buffer, c), Approx(M_SQRT1_2, 1e-2));
+        }
+    }
+}
+
+TEST_CASE("BiquadBank interpolation", "[BiquadBank]") {
+    Dynamo::Sound::Buffer buffer(100, 1);
+    Dynamo::Sound::BiquadBank bank(1, 1);
+
+    // Coefficients set before the first block apply immediately
+    Dynamo::Sound::BiquadCoefficients half;
+    half.b0 = 0.5;
+    bank.set(0, half);
+    std::fill(buffer[0], buffer[0] + buffer.frames(), 1);
+    bank.process(buffer, buffer);
+    REQUIRE_THAT(buffer[0][0], Approx(0.5, 1e-6));
+
+    // Later changes ramp over the next block
+    Dynamo::Sound::BiquadCoefficients quarter;
+    quarter.b0 = 0.25;
+    bank.set(0, quarter);
+    std::fill(buffer[0], buffer[0] + buffer.frames(), 1);
+    bank.process(buffer, buffer);
+    REQUIRE_THAT(buffer[0][0], Approx(0.5, 1e-6));
+    for (unsigned f = 1; f < buffer.frames(); f++) {
+        REQUIRE(buffer[0][f] < buffer[0][f - 1]);
+        REQUIRE(buffer[0][f] > 0.25);
+    }
+
+    std::fill(buffer[0], buffer[0] + buffer.frames(), 1);
+    bank.process(buffer, buffer);
+    REQUIRE_THAT(buffer[0][0], Approx(0.25, 1e-6));
+}
+
+TEST_CASE("Biquad apply", "[Biquad]") {
+    Dynamo::Sound::Buffer buffer(44100, 2);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = std::sin(2 * M_PI * 100 * f / Dynamo::Sound::STANDARD_SAMPLE_RATE);
+        buffer[1][f] = std::sin(2 * M_PI * 15000 * f / Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    }
+
+    Dynamo::Sound::Biquad biquad({Dynamo::Sound::BiquadCoefficients::highpass(5000)});
+    Dynamo::Sound::Source source(buffer);
+    Dynamo::Sound::Listener listener;
+    biquad.apply(buffer, buffer, source, listener);
+
+    REQUIRE(buffer.channels() == 2);
+    REQUIRE(settled_rms(buffer, 0) < 0.01);
+    REQUIRE_THAT(settled_rms(buffer, 1), Approx(M_SQRT1_2, 5e-2));
+}
+
+TEST_CASE("BiquadBank benchmarks", "[BiquadBank]") {
+    // A two-section filter on each of 256 voices
+    Dynamo::Sound::Buffer buffer(Dynamo::Sound::MAX_CHUNK_LENGTH, 256);
+    for (unsigned c = 0; c < buffer.channels(); c++) {
+        for (unsigned f = 0; f < buffer.frames(); f++) {
+            buffer[c][f] = std::sin(0.01f * (f + c));
+        }
+    }
+    Dynamo::Sound::BiquadBank bank(buffer.channels(), 2);
+    bank.set(0, Dynamo::Sound::BiquadCoefficients::lowpass(2000));
+    bank.set(1, Dynamo::Sound::BiquadCoefficients::peak(500, 6));
+
+    BENCHMARK("256 voices") { bank.process(buffer, buffer); };
+}
\ No newline at end of file
@@ -68,6 +68,12 @@ TEST_CASE("Buffer construction", "[Buffer]") {
             REQUIRE(buffer[c][f] == copy[c][f]);
         }
     }
+
+    // The sample rate defaults to the standard and is kept by copies
+    REQUIRE(buffer.sample_rate() == Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    buffer = Dynamo::Sound::Buffer(4, 1, 48000);
+    copy = buffer;
+    REQUIRE(copy.sample_rate() == 48000);
 }
 
 TEST_CASE("Buffer silence", "[Buffer]") {
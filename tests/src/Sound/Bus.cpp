@@ -0,0 +1,125 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Filter that counts how many times it is applied.
+ *
+ */
+struct CountingFilter : Dynamo::Sound::Filter {
+    unsigned count = 0;
+    float gain = 1;
+
+    void apply(const Dynamo::Sound::Buffer &src,
+               Dynamo::Sound::Buffer &dst,
+               const Dynamo::Sound::Source &source,
+               const Dynamo::Sound::Listener &listener) override {
+        count++;
+        for (unsigned c = 0; c < src.channels(); c++) {
+            Dynamo::Vectorize::smul(src[c], gain, dst[c], src.frames());
+        }
+    }
+};
+
+TEST_CASE("Bus shared filter", "[Bus]") {
+    Dynamo::Sound::Buffer buffer(2000, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.1;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    CountingFilter filter;
+    filter.gain = 0.5;
+    Dynamo::Sound::Bus bus(filter);
+    jukebox.add_bus(bus);
+
+    std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+    for (unsigned i = 0; i < 8; i++) {
+        sources.emplace_back(new Dynamo::Sound::Source(buffer));
+        sources.back()->set_output(bus);
+        jukebox.play(*sources.back());
+    }
+
+    // The filter runs once per chunk on the sum of all sources
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH * 4, dst);
+    REQUIRE(filter.count == 4);
+    REQUIRE_THAT(dst[0][500], Approx(0.4, 1e-3));
+
+    // Sources routed into a bus that is not added are not heard
+    jukebox.remove_bus(bus);
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE(filter.count == 4);
+    REQUIRE(dst[0][100] == 0);
+}
+
+TEST_CASE("Bus send", "[Bus]") {
+    Dynamo::Sound::Buffer buffer(2000, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.1;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::Bus bus;
+    bus.volume = 0.5;
+    jukebox.add_bus(bus);
+
+    // The dry signal goes to the master and a copy is sent to the bus
+    Dynamo::Sound::Source source(buffer);
+    source.send(bus, 2);
+    jukebox.play(source);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.2, 1e-3));
+
+    source.send(bus, 0);
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.1, 1e-3));
+}
+
+TEST_CASE("Bus nested", "[Bus]") {
+    Dynamo::Sound::Buffer buffer(2000, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.1;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    CountingFilter master_filter, left_filter, right_filter;
+    master_filter.gain = 2;
+    left_filter.gain = 0.5;
+    right_filter.gain = 0.25;
+
+    Dynamo::Sound::Bus master(master_filter), left(left_filter), right(right_filter);
+    left.set_output(master);
+    right.set_output(master);
+    jukebox.add_bus(left);
+    jukebox.add_bus(master);
+    jukebox.add_bus(right);
+
+    Dynamo::Sound::Source a(buffer), b(buffer);
+    a.set_output(left);
+    b.set_output(right);
+    jukebox.play(a);
+    jukebox.play(b);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE(master_filter.count == 1);
+    REQUIRE(left_filter.count == 1);
+    REQUIRE(right_filter.count == 1);
+    REQUIRE_THAT(dst[0][100], Approx(2 * (0.05 + 0.025), 1e-3));
+}
+
+TEST_CASE("Bus cycle", "[Bus]") {
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::Bus a, b;
+    a.set_output(b);
+    b.set_output(a);
+    jukebox.add_bus(a);
+    jukebox.add_bus(b);
+
+    Dynamo::Sound::Buffer dst;
+    REQUIRE_THROWS(jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst));
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Create a stereo buffer with a sine wave in each channel.
+ *
+ * @param frames
+ * @return Dynamo::Sound::Buffer
+ */
+static Dynamo::Sound::Buffer sine_buffer(unsigned frames) {
+    Dynamo::Sound::Buffer buffer(frames, 2, 48000);
+    for (unsigned f = 0; f < frames; f++) {
+        buffer[0][f] = 0.5 * std::sin(2 * M_PI * 440 * f / 48000);
+        buffer[1][f] = 0.25 * std::sin(2 * M_PI * 1000 * f / 48000);
+    }
+    return buffer;
+}
+
+/**
+ * @brief Largest absolute difference between a compressed buffer decoded from a frame and the original.
+ *
+ * @param compressed
+ * @param buffer
+ * @param first
+ * @param frames
+ * @return float
+ */
+static float decode_error(const Dynamo::Sound::CompressedBuffer &compressed,
+                          const Dynamo::Sound::Buffer &buffer,
+                          unsigned first,
+                          unsigned frames) {
+    Dynamo::Sound::Buffer dst(frames, buffer.channels());
+    compressed.decode(first, dst);
+
+    float error = 0;
+    for (unsigned c = 0; c < buffer.channels(); c++) {
+        for (unsigned f = 0; f < frames; f++) {
+            float expected = first + f < buffer.frames() ? buffer[c][first + f] : 0;
+            error = std::max(error, std::abs(dst[c][f] - expected));
+        }
+    }
+    return error;
+}
+
+TEST_CASE("CompressedBuffer int16", "[CompressedBuffer]") {
+    Dynamo::Sound::Buffer buffer = sine_buffer(1000);
+    Dynamo::Sound::CompressedBuffer compressed(buffer, Dynamo::Sound::SampleFormat::Int16);
+    REQUIRE(compressed.frames() == 1000);
+    REQUIRE(compressed.channels() == 2);
+    REQUIRE(compressed.sample_rate() == 48000);
+    REQUIRE(compressed.size() == 1000 * 2 * sizeof(int16_t));
+
+    REQUIRE(decode_error(compressed, buffer, 0, 1000) < 1e-4);
+    REQUIRE(decode_error(compressed, buffer, 333, 37) < 1e-4);
+
+    // Frames past the end are silent
+    REQUIRE(decode_error(compressed, buffer, 990, 50) < 1e-4);
+    REQUIRE(decode_error(compressed, buffer, 2000, 10) == 0);
+}
+
+TEST_CASE("CompressedBuffer ADPCM", "[CompressedBuffer]") {
+    Dynamo::Sound::Buffer buffer = sine_buffer(1000);
+    Dynamo::Sound::CompressedBuffer compressed(buffer, Dynamo::Sound::SampleFormat::ADPCM);
+    REQUIRE(compressed.size() == 4 * 2 * Dynamo::Sound::ADPCM_BLOCK_SIZE);
+    REQUIRE(compressed.size() * 3 < buffer.frames() * buffer.channels() * sizeof(float));
+
+    // Decoding from any frame matches decoding the whole buffer, since blocks are independent
+    REQUIRE(decode_error(compressed, buffer, 0, 1000) < 0.02);
+    Dynamo::Sound::Buffer all(1000, 2);
+    Dynamo::Sound::Buffer part(300, 2);
+    compressed.decode(0, all);
+    compressed.decode(200, part);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned f = 0; f < part.frames(); f++) {
+            REQUIRE(part[c][f] == all[c][200 + f]);
+        }
+    }
+    REQUIRE(decode_error(compressed, buffer, 900, 300) < 0.02);
+}
+
+TEST_CASE("CompressedBuffer playback", "[CompressedBuffer]") {
+    Dynamo::Sound::Buffer buffer = sine_buffer(4000);
+    Dynamo::Sound::CompressedBuffer compressed(buffer, Dynamo::Sound::SampleFormat::ADPCM);
+
+    // A compressed source sounds like the original
+    auto render = [](Dynamo::Sound::Source &source, Dynamo::Sound::Buffer &dst) {
+        Dynamo::Sound::Jukebox jukebox(2, 48000);
+        jukebox.play(source);
+        jukebox.render(4000, dst);
+    };
+    Dynamo::Sound::Source original_source(buffer);
+    Dynamo::Sound::Source compressed_source(compressed);
+    Dynamo::Sound::Buffer original_dst;
+    Dynamo::Sound::Buffer compressed_dst;
+    render(original_source, original_dst);
+    render(compressed_source, compressed_dst);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned f = 0; f < 4000; f++) {
+            REQUIRE_THAT(compressed_dst[c][f], Approx(original_dst[c][f], 0.02));
+        }
+    }
+}
+
+TEST_CASE("CompressedBuffer benchmark", "[CompressedBuffer]") {
+    Dynamo::Sound::Buffer buffer = sine_buffer(48000);
+    Dynamo::Sound::CompressedBuffer pcm(buffer, Dynamo::Sound::SampleFormat::Int16);
+    Dynamo::Sound::CompressedBuffer adpcm(buffer, Dynamo::Sound::SampleFormat::ADPCM);
+    Dynamo::Sound::Buffer dst(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+
+    BENCHMARK("Int16 chunk") { pcm.decode(1000, dst); };
+    BENCHMARK("ADPCM chunk") { adpcm.decode(1000, dst); };
+}
\ No newline at end of file
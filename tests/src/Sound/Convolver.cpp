@@ -0,0 +1,117 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Directly convolve a signal with an impulse response.
+ *
+ * @param signal
+ * @param ir
+ * @param n      Index of the output sample
+ * @return float
+ */
+static float convolve(const std::vector<float> &signal, const std::vector<float> &ir, unsigned n) {
+    float sum = 0;
+    for (unsigned k = 0; k < ir.size() && k <= n; k++) {
+        sum += ir[k] * signal[n - k];
+    }
+    return sum;
+}
+
+TEST_CASE("Convolver compute", "[Convolver]") {
+    std::vector<float> signal(Dynamo::Sound::BLOCK_LENGTH * 3);
+    for (unsigned i = 0; i < signal.size(); i++) {
+        signal[i] = std::sin(i * 0.1f);
+    }
+    std::vector<float> ir(300);
+    for (unsigned i = 0; i < ir.size(); i++) {
+        ir[i] = std::exp(-0.01f * i) * (i % 2 ? -0.5f : 0.5f);
+    }
+
+    Dynamo::Sound::Convolver convolver;
+    convolver.initialize(ir.data(), ir.size());
+
+    std::vector<float> dst(Dynamo::Sound::BLOCK_LENGTH);
+    for (unsigned block = 0; block < 3; block++) {
+        unsigned offset = block * Dynamo::Sound::BLOCK_LENGTH;
+        convolver.compute(signal.data() + offset, dst.data(), Dynamo::Sound::BLOCK_LENGTH);
+        for (unsigned i = 0; i < Dynamo::Sound::BLOCK_LENGTH; i++) {
+            REQUIRE_THAT(dst[i], Approx(convolve(signal, ir, offset + i), 1e-3));
+        }
+    }
+}
+
+TEST_CASE("Convolver stereo response", "[Convolver]") {
+    std::vector<float> signal(Dynamo::Sound::BLOCK_LENGTH * 2);
+    for (unsigned i = 0; i < signal.size(); i++) {
+        signal[i] = std::cos(i * 0.37f);
+    }
+    std::vector<float> left(200), right(200);
+    for (unsigned i = 0; i < left.size(); i++) {
+        left[i] = std::exp(-0.02f * i);
+        right[i] = std::sin(i * 0.5f) * std::exp(-0.03f * i);
+    }
+
+    // Both channels are convolved against the same input
+    Dynamo::Sound::Convolver convolver;
+    convolver.set_response(std::make_shared<const Dynamo::Sound::ImpulseResponse>(left.data(), right.data(), 200),
+                           false);
+
+    std::vector<float> dst_l(Dynamo::Sound::BLOCK_LENGTH), dst_r(Dynamo::Sound::BLOCK_LENGTH);
+    for (unsigned block = 0; block < 2; block++) {
+        unsigned offset = block * Dynamo::Sound::BLOCK_LENGTH;
+        convolver.compute(signal.data() + offset, dst_l.data(), dst_r.data(), Dynamo::Sound::BLOCK_LENGTH);
+        for (unsigned i = 0; i < Dynamo::Sound::BLOCK_LENGTH; i++) {
+            REQUIRE_THAT(dst_l[i], Approx(convolve(signal, left, offset + i), 1e-3));
+            REQUIRE_THAT(dst_r[i], Approx(convolve(signal, right, offset + i), 1e-3));
+        }
+    }
+}
+
+TEST_CASE("Convolver crossfade", "[Convolver]") {
+    std::vector<float> signal(Dynamo::Sound::BLOCK_LENGTH * 2, 1);
+    std::vector<float> a(1, 1), b(1, -1);
+
+    Dynamo::Sound::Convolver convolver;
+    convolver.set_response(std::make_shared<const Dynamo::Sound::ImpulseResponse>(a.data(), 1), false);
+
+    std::vector<float> dst(Dynamo::Sound::BLOCK_LENGTH);
+    convolver.compute(signal.data(), dst.data(), Dynamo::Sound::BLOCK_LENGTH);
+    REQUIRE_THAT(dst.back(), Approx(1, 1e-4));
+
+    // The first block after a change fades linearly to the new response
+    convolver.set_response(std::make_shared<const Dynamo::Sound::ImpulseResponse>(b.data(), 1), true);
+    convolver.compute(signal.data(), dst.data(), Dynamo::Sound::BLOCK_LENGTH);
+    REQUIRE_THAT(dst.front(), Approx(1, 1e-2));
+    REQUIRE_THAT(dst[Dynamo::Sound::BLOCK_LENGTH / 2 - 1], Approx(0, 1e-3));
+    REQUIRE_THAT(dst.back(), Approx(-1, 1e-4));
+    for (unsigned i = 1; i < Dynamo::Sound::BLOCK_LENGTH; i++) {
+        REQUIRE(dst[i] <= dst[i - 1]);
+    }
+
+    // Subsequent blocks use the new response only
+    convolver.compute(signal.data(), dst.data(), Dynamo::Sound::BLOCK_LENGTH);
+    REQUIRE_THAT(dst.front(), Approx(-1, 1e-4));
+}
+
+TEST_CASE("Convolver benchmarks", "[Convolver]") {
+    std::vector<float> src(Dynamo::Sound::BLOCK_LENGTH), dst(Dynamo::Sound::BLOCK_LENGTH);
+    for (unsigned i = 0; i < src.size(); i++) {
+        src[i] = std::sin(i * 0.1f);
+    }
+
+    for (unsigned M : {200, 1024, 4096, 16384, 65536}) {
+        std::vector<float> ir(M);
+        for (unsigned i = 0; i < M; i++) {
+            ir[i] = std::sin(i * 0.3f) * 0.01f;
+        }
+
+        Dynamo::Sound::Convolver convolver;
+        convolver.initialize(ir.data(), M);
+        BENCHMARK("Convolver compute benchmark, " + std::to_string(M) + " taps") {
+            convolver.compute(src.data(), dst.data(), Dynamo::Sound::BLOCK_LENGTH);
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+TEST_CASE("HRIRCache direction", "[HRIRCache]") {
+    Dynamo::Sound::HRIRCache cache;
+    Dynamo::Vec3 origin(0, 0, 0);
+    Dynamo::Quaternion rotation;
+
+    // Nearby positions share a direction
+    unsigned a = cache.direction(origin, rotation, Dynamo::Vec3(1, 0, 2));
+    unsigned b = cache.direction(origin, rotation, Dynamo::Vec3(1, 0.001, 2));
+    REQUIRE(a == b);
+
+    unsigned c = cache.direction(origin, rotation, Dynamo::Vec3(-1, 0, 2));
+    REQUIRE(a != c);
+
+    // Degenerate positions are still mapped to a direction
+    REQUIRE_NOTHROW(cache.get(cache.direction(origin, rotation, origin)));
+}
+
+TEST_CASE("HRIRCache get", "[HRIRCache]") {
+    Dynamo::Sound::HRIRCache cache(2);
+
+    auto a = cache.get(0);
+    REQUIRE(a->partition_count > 0);
+    REQUIRE(cache.get(0) == a);
+
+    // Least recently used directions are evicted
+    auto b = cache.get(1);
+    cache.get(0);
+    cache.get(2);
+    REQUIRE(cache.get(0) == a);
+    REQUIRE(cache.get(1) != b);
+}
+
+TEST_CASE("HRIRCache find", "[HRIRCache]") {
+    Dynamo::Sound::HRIRCache cache(1);
+
+    // Only computed directions are found
+    REQUIRE(cache.find(0) == nullptr);
+    auto a = cache.get(0);
+    REQUIRE(cache.find(0) == a);
+
+    // Evicted responses are held by the cache until no one else uses them
+    std::weak_ptr<const Dynamo::Sound::ImpulseResponse> weak = a;
+    cache.get(1);
+    REQUIRE(cache.find(0) == nullptr);
+    a.reset();
+    REQUIRE(!weak.expired());
+
+    // They are freed by the next computation
+    cache.get(2);
+    REQUIRE(weak.expired());
+}
\ No newline at end of file
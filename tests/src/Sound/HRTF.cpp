@@ -0,0 +1,84 @@
+#include <Dynamo.hpp>
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+TEST_CASE("HRTF lookup", "[HRTF]") {
+    Dynamo::Sound::HRTF hrtf;
+    Dynamo::Sound::Buffer dst(Dynamo::Sound::HRIR_LENGTH, 2);
+    Dynamo::Vec3 listener(0, 0, 0);
+    Dynamo::Quaternion rotation;
+
+    // Sweep the azimuth and elevation through the triangulated point space
+    for (float az = -89; az <= 89; az += 7) {
+        for (float el = -60; el <= 175; el += 11) {
+            float az_r = Dynamo::to_radians(az);
+            float el_r = Dynamo::to_radians(el);
+            Dynamo::Vec3 source(std::sin(az_r),
+                                std::cos(az_r) * std::cos(el_r),
+                                -std::cos(az_r) * std::sin(el_r));
+            REQUIRE_NOTHROW(hrtf.calculate_HRIR(listener, rotation, source, dst));
+        }
+    }
+}
+
+TEST_CASE("HRTF grid lookup matches full scan", "[HRTF]") {
+    Dynamo::Sound::HRTF hrtf;
+    Dynamo::Sound::Buffer dst(Dynamo::Sound::HRIR_LENGTH, 2);
+
+    // Rebuild the point space and its triangulation to scan every triangle
+    std::vector<Dynamo::Vec2> points;
+    for (float az : Dynamo::Sound::HRTF_AZIMUTHS) {
+        points.emplace_back(az, -90);
+        for (unsigned i = 0; i < 50; i++) {
+            points.emplace_back(az, -45 + 5.625 * i);
+        }
+        points.emplace_back(az, 270);
+    }
+    std::vector<Dynamo::Vec2> tmp_points = points;
+    std::vector<Dynamo::Triangle2> triangles = Dynamo::Delaunay::triangulate(tmp_points);
+    auto index_of = [&](const Dynamo::Vec2 &point) {
+        return std::find(points.begin(), points.end(), point) - points.begin();
+    };
+
+    for (float az = -89; az <= 89; az += 3.7) {
+        for (float el = -89; el <= 269; el += 4.3) {
+            Dynamo::Vec2 point(az, el);
+            hrtf.calculate_HRIR(point, dst);
+
+            // Points on a shared edge may be rounded outside of both triangles, so take the one it is deepest inside
+            const Dynamo::Triangle2 *found = nullptr;
+            Dynamo::Vec3 coords;
+            float depth = -1;
+            for (const Dynamo::Triangle2 &triangle : triangles) {
+                Dynamo::Vec3 triangle_coords = triangle.barycentric(point);
+                float triangle_depth = std::min({triangle_coords.x, triangle_coords.y, triangle_coords.z});
+                if (triangle_depth > depth) {
+                    found = &triangle;
+                    coords = triangle_coords;
+                    depth = triangle_depth;
+                }
+            }
+            REQUIRE(found != nullptr);
+            REQUIRE(depth > -1e-3);
+
+            unsigned a = index_of(found->a);
+            unsigned b = index_of(found->b);
+            unsigned c = index_of(found->c);
+            float energy = 0;
+            for (unsigned ch = 0; ch < 2; ch++) {
+                for (unsigned f = 0; f < Dynamo::Sound::HRIR_LENGTH; f++) {
+                    auto coefficient = [&](unsigned index) {
+                        unsigned offset = (index * 2 + ch) * Dynamo::Sound::HRIR_LENGTH + f;
+                        return Dynamo::Sound::HRIR_COEFFICIENTS[offset];
+                    };
+                    float expected = coefficient(a) * coords.x + coefficient(b) * coords.y + coefficient(c) * coords.z;
+                    REQUIRE_THAT(dst[ch][f], Approx(expected, 1e-4));
+                    energy += dst[ch][f] * dst[ch][f];
+                }
+            }
+            REQUIRE(energy > 0);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "../Common.hpp"
+
+TEST_CASE("Jukebox offline", "[Jukebox]") {
+    Dynamo::Sound::Jukebox jukebox(2, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    REQUIRE(jukebox.is_offline());
+    REQUIRE(jukebox.get_channels() == 2);
+    REQUIRE(jukebox.get_sample_rate() == Dynamo::Sound::STANDARD_SAMPLE_RATE);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(100, dst);
+    REQUIRE(dst.frames() == 100);
+    REQUIRE(dst.channels() == 2);
+    for (unsigned c = 0; c < dst.channels(); c++) {
+        for (unsigned f = 0; f < dst.frames(); f++) {
+            REQUIRE(dst[c][f] == 0);
+        }
+    }
+}
+
+TEST_CASE("Jukebox render", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(1000, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::Source source(buffer);
+    bool finished = false;
+    source.set_on_finish([&]() { finished = true; });
+    jukebox.play(source);
+
+    // Render across multiple chunks and past the end of the source
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(1500, dst);
+    REQUIRE(dst.frames() == 1500);
+    REQUIRE_THAT(dst[0][500], Approx(0.5, 1e-2));
+    REQUIRE(dst[0][1200] == 0);
+
+    jukebox.render(1, dst);
+    REQUIRE(finished);
+    REQUIRE(!source.is_playing());
+}
+
+TEST_CASE("Jukebox replay", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(1000, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::Source source(buffer);
+    unsigned finished = 0;
+    source.set_on_finish([&]() { finished++; });
+    jukebox.play(source);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(1500, dst);
+    REQUIRE(finished == 1);
+    REQUIRE(!source.is_playing());
+
+    // Each play is only reported finished once, after it reaches the stop time
+    source.seek(Dynamo::Seconds(0));
+    jukebox.play(source);
+    jukebox.render(500, dst);
+    REQUIRE(source.is_playing());
+    REQUIRE(finished == 1);
+    REQUIRE_THAT(dst[0][100], Approx(0.5, 1e-2));
+
+    jukebox.render(1000, dst);
+    REQUIRE(finished == 2);
+    REQUIRE(!source.is_playing());
+    REQUIRE(dst[0][600] == 0);
+}
+
+TEST_CASE("Jukebox native sample rate", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(1000, 1, 22050);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    // The source is resampled once from its own rate to the device rate
+    Dynamo::Sound::Jukebox jukebox(1, 48000);
+    Dynamo::Sound::Source source(buffer);
+    jukebox.play(source);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(2500, dst);
+    REQUIRE_THAT(dst[0][1000], Approx(0.5, 1e-2));
+    REQUIRE_THAT(dst[0][2100], Approx(0.5, 1e-2));
+    REQUIRE(dst[0][2200] == 0);
+
+    // Seeking is relative to the native sample rate
+    source.seek(Dynamo::Seconds(0.044));
+    jukebox.play(source);
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][30], Approx(0.5, 1e-2));
+    REQUIRE(dst[0][100] == 0);
+}
+
+TEST_CASE("Jukebox commands", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    Dynamo::Sound::Source source(buffer);
+    source.volume = 0.5;
+    jukebox.play(source);
+    REQUIRE(source.is_playing());
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.25, 1e-2));
+
+    // Pausing and playing again before the next chunk keeps the source playing
+    jukebox.pause(source);
+    REQUIRE(!source.is_playing());
+    jukebox.play(source);
+    source.volume = 1;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.5, 1e-2));
+
+    // Seeking to the end is applied at the start of the next chunk
+    source.seek(Dynamo::Seconds(1));
+    REQUIRE(source.is_playing());
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE(dst[0][100] == 0);
+    REQUIRE(!source.is_playing());
+}
+
+TEST_CASE("Jukebox destroy source", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    auto source = std::make_unique<Dynamo::Sound::Source>(buffer);
+    jukebox.play(*source);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.5, 1e-2));
+
+    // A playing source is no longer mixed once it is destroyed
+    source.reset();
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE(dst[0][100] == 0);
+
+    // Sources can also outlive the Jukebox they were played on
+    Dynamo::Sound::Source other(buffer);
+    {
+        Dynamo::Sound::Jukebox temporary(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+        temporary.play(other);
+    }
+    jukebox.play(other);
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH, dst);
+    REQUIRE_THAT(dst[0][100], Approx(0.5, 1e-2));
+}
+
+TEST_CASE("Jukebox render deterministic", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 2);
+    for (unsigned c = 0; c < buffer.channels(); c++) {
+        for (unsigned f = 0; f < buffer.frames(); f++) {
+            buffer[c][f] = ((f * 7 + c * 13) % 17) / 17.0 - 0.5;
+        }
+    }
+
+    auto render = [&](Dynamo::Sound::Buffer &dst, unsigned threads) {
+        Dynamo::Sound::Jukebox jukebox(2, 48000, threads);
+        Dynamo::Sound::Amplify amplify;
+        amplify.gain = 0.25;
+
+        std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+        for (unsigned i = 0; i < 16; i++) {
+            if (i % 2) {
+                sources.emplace_back(new Dynamo::Sound::Source(buffer, amplify));
+            } else {
+                sources.emplace_back(new Dynamo::Sound::Source(buffer));
+            }
+            sources.back()->volume = 0.01 + 0.007 * i;
+            jukebox.play(*sources.back());
+        }
+        jukebox.render(3000, dst);
+    };
+
+    // The partial mixes and their sum do not depend on the number of threads
+    Dynamo::Sound::Buffer a;
+    render(a, 1);
+    for (unsigned threads : {1, 2, 3, 8}) {
+        Dynamo::Sound::Buffer b;
+        render(b, threads);
+        REQUIRE(a.frames() == b.frames());
+        for (unsigned c = 0; c < a.channels(); c++) {
+            for (unsigned f = 0; f < a.frames(); f++) {
+                REQUIRE(a[c][f] == b[c][f]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Jukebox real-time callback sizes", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = ((f * 7) % 17) / 17.0 - 0.5;
+    }
+
+    // A response longer than a chunk, so the convolution carries state across chunks
+    Dynamo::Sound::Buffer ir(1000, 1);
+    for (unsigned f = 0; f < ir.frames(); f++) {
+        ir[0][f] = std::exp(-0.005f * f) * (((f * 13) % 7) / 7.0 - 0.5);
+    }
+
+    auto render = [&](std::vector<Dynamo::Sound::WaveSample> &dst, const std::vector<unsigned> &sizes) {
+        Dynamo::Sound::Jukebox jukebox(1, 48000);
+        Dynamo::Sound::Reverb reverb(ir, 48000);
+        Dynamo::Sound::Source source(buffer, reverb);
+        jukebox.set_realtime(true);
+        jukebox.play(source);
+        jukebox.update();
+
+        // Cycle through the callback sizes until the destination is filled
+        unsigned offset = 0;
+        for (unsigned i = 0; offset < dst.size(); i++) {
+            unsigned frames = std::min<unsigned>(sizes[i % sizes.size()], dst.size() - offset);
+            jukebox.render(dst.data() + offset, frames);
+            offset += frames;
+        }
+    };
+
+    std::vector<Dynamo::Sound::WaveSample> aligned(3000);
+    std::vector<Dynamo::Sound::WaveSample> odd(3000);
+    render(aligned, {Dynamo::Sound::MAX_CHUNK_LENGTH});
+    render(odd, {100, 37, 300, 1, 511, 256, 64});
+
+    // Filters see the same whole chunks however the device splits them
+    float energy = 0;
+    for (unsigned f = 0; f < aligned.size(); f++) {
+        REQUIRE_THAT(odd[f], Approx(aligned[f], 1e-6));
+        energy += aligned[f] * aligned[f];
+    }
+    REQUIRE(energy > 0);
+}
+
+/**
+ * @brief Filter that records whether it was applied on two threads at once.
+ *
+ */
+struct ExclusiveFilter : Dynamo::Sound::Filter {
+    std::atomic<unsigned> active = 0;
+    std::atomic_bool overlapped = false;
+
+    void apply(const Dynamo::Sound::Buffer &src,
+               Dynamo::Sound::Buffer &dst,
+               const Dynamo::Sound::Source &source,
+               const Dynamo::Sound::Listener &listener) override {
+        if (active.fetch_add(1) > 0) {
+            overlapped = true;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        active.fetch_sub(1);
+    }
+};
+
+TEST_CASE("Jukebox shared filters", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+
+    // Each source has its own sequence, but they all reach the same inner filter
+    Dynamo::Sound::Jukebox jukebox(1, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    ExclusiveFilter shared;
+    std::vector<std::unique_ptr<Dynamo::Sound::FilterSequence>> sequences;
+    std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+    for (unsigned i = 0; i < 8; i++) {
+        sequences.emplace_back(new Dynamo::Sound::FilterSequence());
+        sequences.back()->push(shared);
+        sources.emplace_back(new Dynamo::Sound::Source(buffer, *sequences.back()));
+        jukebox.play(*sources.back());
+    }
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH * 8, dst);
+    REQUIRE(!shared.overlapped);
+}
+
+TEST_CASE("Jukebox stats", "[Jukebox]") {
+    Dynamo::Sound::Buffer buffer(4096, 1);
+    for (unsigned f = 0; f < buffer.frames(); f++) {
+        buffer[0][f] = 0.5;
+    }
+    Dynamo::Sound::Jukebox jukebox(2, 48000);
+    Dynamo::Sound::Amplify amplify;
+    Dynamo::Sound::Source a(buffer);
+    Dynamo::Sound::Source b(buffer, amplify);
+    jukebox.play(a);
+    jukebox.play(b);
+
+    Dynamo::Sound::Buffer dst;
+    jukebox.render(Dynamo::Sound::MAX_CHUNK_LENGTH * 3, dst);
+    Dynamo::Sound::Stats stats = jukebox.stats();
+    REQUIRE(stats.chunks == 3);
+    REQUIRE(stats.voice_chunks == 6);
+    REQUIRE(stats.real_voices == 2);
+    REQUIRE(stats.virtual_voices == 0);
+    REQUIRE(stats.mix_time > 0);
+    REQUIRE(stats.max_mix_time <= stats.mix_time);
+    REQUIRE(stats.max_load > 0);
+    REQUIRE(stats.resample_time + stats.filter_time + stats.remix_time > 0);
+
+    // Offline rendering has no device to underflow
+    REQUIRE(stats.output_underflows == 0);
+    REQUIRE(stats.dropped_frames == 0);
+    REQUIRE(stats.buffered_frames == 0);
+
+    jukebox.reset_stats();
+    stats = jukebox.stats();
+    REQUIRE(stats.chunks == 0);
+    REQUIRE(stats.voice_chunks == 0);
+    REQUIRE(stats.mix_time == 0);
+    REQUIRE(stats.max_load == 0);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Convolve a signal with long impulse responses in chunks and compare
+ * against direct convolution.
+ *
+ * @param scheduler
+ */
+static void check_convolution(Dynamo::DeadlineScheduler &scheduler) {
+    unsigned M = 12000;
+    Dynamo::Sound::Buffer ir(M, 2);
+    for (unsigned i = 0; i < M; i++) {
+        ir[0][i] = std::exp(-0.0005f * i) * std::sin(i * 0.9f) * 0.05f;
+        ir[1][i] = std::exp(-0.0003f * i) * std::cos(i * 0.4f) * 0.05f;
+    }
+
+    unsigned length = 80 * Dynamo::Sound::BLOCK_LENGTH;
+    std::vector<float> signal(length);
+    for (unsigned i = 0; i < length; i++) {
+        signal[i] = std::sin(i * 0.05f) + 0.5f * std::sin(i * 0.31f);
+    }
+
+    Dynamo::Sound::NonUniformConvolver convolver(ir, Dynamo::Sound::STANDARD_SAMPLE_RATE, scheduler);
+    REQUIRE(convolver.channels() == 2);
+
+    Dynamo::Sound::Buffer dst(Dynamo::Sound::BLOCK_LENGTH, 2);
+    for (unsigned offset = 0; offset < length; offset += Dynamo::Sound::BLOCK_LENGTH) {
+        convolver.compute(signal.data() + offset, dst, Dynamo::Sound::BLOCK_LENGTH);
+        for (unsigned i = 0; i < Dynamo::Sound::BLOCK_LENGTH; i += 7) {
+            unsigned n = offset + i;
+            for (unsigned c = 0; c < 2; c++) {
+                double expected = 0;
+                for (unsigned k = 0; k < M && k <= n; k++) {
+                    expected += ir[c][k] * signal[n - k];
+                }
+                REQUIRE_THAT(dst[c][i], Approx(expected, 1e-3));
+            }
+        }
+    }
+}
+
+TEST_CASE("NonUniformConvolver compute", "[NonUniformConvolver]") {
+    Dynamo::DeadlineScheduler scheduler(1);
+    check_convolution(scheduler);
+}
+
+TEST_CASE("NonUniformConvolver compute inline", "[NonUniformConvolver]") {
+    // Without workers, every tail block is computed at its deadline
+    Dynamo::DeadlineScheduler scheduler(0);
+    check_convolution(scheduler);
+}
+
+TEST_CASE("NonUniformConvolver short response", "[NonUniformConvolver]") {
+    float taps[3] = {0.5, 0.25, -1};
+    Dynamo::Sound::Buffer ir(taps, 3, 1);
+    Dynamo::Sound::NonUniformConvolver convolver(ir);
+    REQUIRE(convolver.channels() == 1);
+
+    std::vector<float> impulse(Dynamo::Sound::BLOCK_LENGTH, 0);
+    impulse[0] = 1;
+    Dynamo::Sound::Buffer dst(Dynamo::Sound::BLOCK_LENGTH, 1);
+    convolver.compute(impulse.data(), dst, Dynamo::Sound::BLOCK_LENGTH);
+    REQUIRE_THAT(dst[0][0], Approx(0.5, 1e-5));
+    REQUIRE_THAT(dst[0][1], Approx(0.25, 1e-5));
+    REQUIRE_THAT(dst[0][2], Approx(-1, 1e-5));
+    REQUIRE_THAT(dst[0][3], Approx(0, 1e-5));
+}
\ No newline at end of file
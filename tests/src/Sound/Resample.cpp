@@ -0,0 +1,109 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Fill a buffer with a sine wave.
+ *
+ * @param buffer
+ * @param frequency   Frequency in Hz
+ * @param sample_rate
+ */
+static void sine(Dynamo::Sound::Buffer &buffer, double frequency, double sample_rate) {
+    for (unsigned c = 0; c < buffer.channels(); c++) {
+        for (unsigned f = 0; f < buffer.frames(); f++) {
+            buffer[c][f] = std::sin(2 * M_PI * frequency * f / sample_rate + c);
+        }
+    }
+}
+
+TEST_CASE("Resampler bypass", "[Resampler]") {
+    Dynamo::Sound::Resampler resampler(44100, 44100);
+    REQUIRE(resampler.is_bypass());
+    REQUIRE(resampler.ratio() == 1);
+
+    Dynamo::Sound::Buffer src(64, 2);
+    for (unsigned i = 0; i < 64 * 2; i++) {
+        src.data()[i] = i;
+    }
+
+    Dynamo::Sound::Buffer dst(16, 2);
+    resampler.process(src, dst, 10);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned f = 0; f < 16; f++) {
+            REQUIRE(dst[c][f] == src[c][f + 10]);
+        }
+    }
+
+    // Frames past the end are silent
+    resampler.process(src, dst, 56);
+    REQUIRE(dst[0][7] == src[0][63]);
+    REQUIRE(dst[0][8] == 0);
+}
+
+TEST_CASE("Resampler ratio", "[Resampler]") {
+    Dynamo::Sound::Resampler up(44100, 48000);
+    REQUIRE(!up.is_bypass());
+    REQUIRE_THAT(up.ratio(), Approx(147.0 / 160.0));
+
+    Dynamo::Sound::Resampler down(48000, 44100);
+    REQUIRE_THAT(down.ratio(), Approx(160.0 / 147.0));
+    REQUIRE(down.radius() >= up.radius());
+
+    // Ratios that need too many phases are approximated
+    Dynamo::Sound::Resampler odd(44100, 44101);
+    REQUIRE_THAT(odd.ratio(), Approx(44100.0 / 44101.0, 1e-3));
+}
+
+TEST_CASE("Resampler upsample", "[Resampler]") {
+    Dynamo::Sound::Buffer src(4096, 2);
+    sine(src, 1000, 44100);
+
+    Dynamo::Sound::Resampler resampler(44100, 48000);
+    Dynamo::Sound::Buffer dst(1024, 2);
+    resampler.process(src, dst, 1000.5);
+
+    // Compare against the ideal signal at each interpolated position
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned f = 0; f < dst.frames(); f++) {
+            double time = 1000.5 + f * resampler.ratio();
+            double expected = std::sin(2 * M_PI * 1000 * time / 44100 + c);
+            REQUIRE_THAT(dst[c][f], Approx(expected, 1e-3));
+        }
+    }
+}
+
+TEST_CASE("Resampler downsample", "[Resampler]") {
+    Dynamo::Sound::Buffer src(4096, 1);
+    sine(src, 1000, 48000);
+
+    Dynamo::Sound::Resampler resampler(48000, 44100);
+    Dynamo::Sound::Buffer dst(1024, 1);
+    resampler.process(src, dst, 100);
+    for (unsigned f = 0; f < dst.frames(); f++) {
+        double time = 100 + f * resampler.ratio();
+        double expected = std::sin(2 * M_PI * 1000 * time / 48000);
+        REQUIRE_THAT(dst[0][f], Approx(expected, 1e-3));
+    }
+}
+
+TEST_CASE("Resampler chunks", "[Resampler]") {
+    Dynamo::Sound::Buffer src(4096, 1);
+    sine(src, 440, 44100);
+
+    Dynamo::Sound::Resampler resampler(44100, 48000);
+    Dynamo::Sound::Buffer whole(1000, 1);
+    resampler.process(src, whole, 0);
+
+    // Resampling in chunks matches resampling all at once
+    Dynamo::Sound::Buffer chunk(100, 1);
+    double time = 0;
+    for (unsigned offset = 0; offset < whole.frames(); offset += chunk.frames()) {
+        resampler.process(src, chunk, time);
+        for (unsigned f = 0; f < chunk.frames(); f++) {
+            REQUIRE_THAT(chunk[0][f], Approx(whole[0][offset + f]));
+        }
+        time += chunk.frames() * resampler.ratio();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+TEST_CASE("Reverb apply", "[Reverb]") {
+    // Stereo response that delays each channel by a different amount
+    Dynamo::Sound::Buffer ir(3, 2);
+    ir.silence();
+    ir[0][1] = 1;
+    ir[1][2] = 1;
+
+    Dynamo::Sound::Reverb reverb(ir);
+    reverb.dry = 1;
+    reverb.wet = 0.5;
+
+    Dynamo::Sound::Buffer buffer(Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+    buffer.silence();
+    buffer[0][0] = 1;
+
+    Dynamo::Sound::Source source(buffer);
+    Dynamo::Sound::Listener listener;
+    reverb.apply(buffer, buffer, source, listener);
+
+    REQUIRE(buffer.channels() == 2);
+    REQUIRE(buffer.frames() == Dynamo::Sound::MAX_CHUNK_LENGTH);
+    for (unsigned c = 0; c < 2; c++) {
+        REQUIRE_THAT(buffer[c][0], Approx(1, 1e-5));
+        REQUIRE_THAT(buffer[c][1 + c], Approx(0.5, 1e-5));
+        REQUIRE_THAT(buffer[c][2 - c], Approx(0, 1e-5));
+    }
+}
\ No newline at end of file
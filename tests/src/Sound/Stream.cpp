@@ -0,0 +1,110 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Decoder that generates a ramp, where sample f of channel c is f + c.
+ *
+ */
+class RampDecoder : public Dynamo::Sound::Decoder {
+    unsigned _channels;
+    double _sample_rate;
+    unsigned _frames;
+    unsigned _position = 0;
+
+  public:
+    RampDecoder(unsigned channels, double sample_rate, unsigned frames) :
+        _channels(channels), _sample_rate(sample_rate), _frames(frames) {}
+
+    unsigned channels() const override { return _channels; }
+
+    double sample_rate() const override { return _sample_rate; }
+
+    unsigned frames() const override { return _frames; }
+
+    void seek(unsigned frame) override { _position = std::min(frame, _frames); }
+
+    unsigned read(Dynamo::Sound::WaveSample *dst, unsigned frames) override {
+        unsigned count = std::min(frames, _frames - _position);
+        for (unsigned f = 0; f < count; f++) {
+            for (unsigned c = 0; c < _channels; c++) {
+                dst[f * _channels + c] = _position + f + c;
+            }
+        }
+        _position += count;
+        return count;
+    }
+};
+
+/**
+ * @brief Read from a stream, retrying until the decoder thread has caught up.
+ *
+ * @param stream
+ * @param start
+ * @param dst
+ */
+void read_ready(Dynamo::Sound::Stream &stream, unsigned start, Dynamo::Sound::Buffer &dst) {
+    for (unsigned attempt = 0; attempt < 1000; attempt++) {
+        stream.read(start, dst);
+        if (dst[0][dst.frames() - 1] != 0) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST_CASE("Stream sequential read", "[Stream]") {
+    unsigned frames = Dynamo::Sound::STREAM_BLOCK_LENGTH * 20 + 100;
+    Dynamo::Sound::Stream stream(std::make_unique<RampDecoder>(2, Dynamo::Sound::STANDARD_SAMPLE_RATE, frames));
+    REQUIRE(stream.channels() == 2);
+    REQUIRE(stream.frames() == frames);
+
+    // Read across block boundaries up to the end of the stream
+    Dynamo::Sound::Buffer chunk(1000, 2);
+    for (unsigned start = 1; start + chunk.frames() < frames; start += chunk.frames()) {
+        read_ready(stream, start, chunk);
+        for (unsigned f = 0; f < chunk.frames(); f++) {
+            REQUIRE(chunk[0][f] == start + f);
+            REQUIRE(chunk[1][f] == start + f + 1);
+        }
+    }
+}
+
+TEST_CASE("Stream seek", "[Stream]") {
+    unsigned frames = Dynamo::Sound::STREAM_BLOCK_LENGTH * 40;
+    Dynamo::Sound::Stream stream(std::make_unique<RampDecoder>(1, Dynamo::Sound::STANDARD_SAMPLE_RATE, frames));
+
+    Dynamo::Sound::Buffer chunk(256, 1);
+    read_ready(stream, 10, chunk);
+    REQUIRE(chunk[0][0] == 10);
+
+    // Jump past the read-ahead
+    unsigned forward = Dynamo::Sound::STREAM_BLOCK_LENGTH * 30 + 7;
+    read_ready(stream, forward, chunk);
+    REQUIRE(chunk[0][0] == forward);
+
+    // Jump behind the held blocks
+    read_ready(stream, 5, chunk);
+    REQUIRE(chunk[0][0] == 5);
+    REQUIRE(chunk[0][255] == 260);
+}
+
+TEST_CASE("Stream native rate", "[Stream]") {
+    // Streams are resampled by the mixer, not while decoding
+    unsigned frames = Dynamo::Sound::STREAM_BLOCK_LENGTH * 4;
+    double sample_rate = Dynamo::Sound::STANDARD_SAMPLE_RATE / 2;
+    Dynamo::Sound::Stream stream(std::make_unique<RampDecoder>(1, sample_rate, frames));
+    REQUIRE(stream.sample_rate() == sample_rate);
+    REQUIRE(stream.frames() == frames);
+
+    // Compare across a block boundary
+    Dynamo::Sound::Buffer chunk(512, 1);
+    unsigned start = Dynamo::Sound::STREAM_BLOCK_LENGTH * 3 - 256;
+    read_ready(stream, start, chunk);
+    for (unsigned f = 0; f < chunk.frames(); f++) {
+        REQUIRE(chunk[0][f] == start + f);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+
+#include "../Common.hpp"
+
+TEST_CASE("VoiceManager audibility", "[VoiceManager]") {
+    Dynamo::Sound::Buffer buffer(16, 1);
+    Dynamo::Sound::Listener listener;
+    Dynamo::Sound::Distance distance;
+    distance.inner_radius = 0;
+    distance.outer_radius = 10;
+
+    Dynamo::Sound::Source source(buffer, distance);
+    source.volume = 0.5;
+    source.position = {5, 0, 0};
+    source.publish();
+
+    REQUIRE_THAT(Dynamo::Sound::VoiceManager::audibility(source, listener, 1), Approx(0.25));
+    REQUIRE_THAT(Dynamo::Sound::VoiceManager::audibility(source, listener, 0.5), Approx(0.125));
+
+    source.position = {20, 0, 0};
+    source.publish();
+    REQUIRE_THAT(Dynamo::Sound::VoiceManager::audibility(source, listener, 1), Approx(0));
+}
+
+TEST_CASE("VoiceManager cull", "[VoiceManager]") {
+    Dynamo::Sound::Buffer buffer(16, 1);
+    Dynamo::Sound::Listener listener;
+    Dynamo::Sound::Distance distance;
+    distance.outer_radius = 10;
+
+    Dynamo::Sound::Source near(buffer, distance);
+    Dynamo::Sound::Source far(buffer, distance);
+    Dynamo::Sound::Source muted(buffer);
+    far.position = {20, 0, 0};
+    far.publish();
+    muted.volume = 0;
+    muted.publish();
+
+    std::vector<Dynamo::Sound::SourceRef> sources = {near, far, muted};
+    Dynamo::Sound::VoiceManager voices;
+    voices.update(sources, listener, 1);
+
+    REQUIRE(voices.real_voices().size() == 1);
+    REQUIRE(voices.real_voices()[0] == &near);
+    REQUIRE(voices.virtual_voices().size() == 2);
+}
+
+TEST_CASE("VoiceManager limit", "[VoiceManager]") {
+    Dynamo::Sound::Buffer buffer(16, 1);
+    Dynamo::Sound::Listener listener;
+
+    std::list<Dynamo::Sound::Source> storage;
+    std::vector<Dynamo::Sound::SourceRef> sources;
+    for (unsigned i = 0; i < 8; i++) {
+        Dynamo::Sound::Source &source = storage.emplace_back(buffer);
+        source.volume = (i + 1) / 8.0;
+        source.publish();
+        sources.push_back(source);
+    }
+
+    // The quietest source has the highest priority
+    sources[0].get().priority = 1;
+    sources[0].get().publish();
+
+    Dynamo::Sound::VoiceManager voices(3);
+    voices.update(sources, listener, 1);
+
+    // Real voices keep the order of the sources
+    const std::vector<Dynamo::Sound::Source *> &real = voices.real_voices();
+    REQUIRE(real.size() == 3);
+    REQUIRE(real[0] == &sources[0].get());
+    REQUIRE(real[1] == &sources[6].get());
+    REQUIRE(real[2] == &sources[7].get());
+    REQUIRE(voices.virtual_voices().size() == 5);
+
+    voices.set_max_voices(16);
+    voices.update(sources, listener, 1);
+    REQUIRE(voices.real_voices().size() == 8);
+    REQUIRE(voices.virtual_voices().empty());
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+/**
+ * @brief Push and pop values across several producer and consumer threads.
+ *
+ * @tparam Queue
+ * @param queue
+ * @param threads Number of producers and consumers each.
+ * @param count   Number of values per producer.
+ * @return unsigned long long Sum of all consumed values.
+ */
+template <typename Queue>
+unsigned long long contend(Queue &queue, unsigned threads, unsigned count) {
+    std::atomic<unsigned long long> sum = 0;
+    std::atomic<unsigned> consumed = 0;
+    std::vector<std::thread> pool;
+
+    for (unsigned t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            std::array<unsigned, 8> batch;
+            unsigned next = 0;
+            while (next < count) {
+                unsigned n = std::min<unsigned>(batch.size(), count - next);
+                for (unsigned i = 0; i < n; i++) {
+                    batch[i] = t * count + next + i;
+                }
+                next += queue.push(batch.data(), n);
+            }
+        });
+        pool.emplace_back([&]() {
+            std::array<unsigned, 8> batch;
+            unsigned long long local = 0;
+            while (consumed.load() < threads * count) {
+                unsigned n = queue.pop(batch.data(), batch.size());
+                for (unsigned i = 0; i < n; i++) {
+                    local += batch[i];
+                }
+                consumed += n;
+            }
+            sum += local;
+        });
+    }
+    for (std::thread &thread : pool) {
+        thread.join();
+    }
+    return sum;
+}
+
+/**
+ * @brief Mutex-guarded queue baseline for the contention benchmark.
+ *
+ */
+struct LockedQueue {
+    std::mutex mutex;
+    std::queue<unsigned> queue;
+
+    unsigned push(const unsigned *src, unsigned n) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        for (unsigned i = 0; i < n; i++) {
+            queue.push(src[i]);
+        }
+        return n;
+    }
+
+    unsigned pop(unsigned *dst, unsigned n) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        unsigned count = std::min<unsigned>(n, queue.size());
+        for (unsigned i = 0; i < count; i++) {
+            dst[i] = queue.front();
+            queue.pop();
+        }
+        return count;
+    }
+};
+
+TEST_CASE("ConcurrentQueue push pop", "[ConcurrentQueue]") {
+    Dynamo::ConcurrentQueue<int, 4> queue;
+    REQUIRE(queue.empty());
+    REQUIRE(queue.capacity() == 4);
+
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE(queue.push(3));
+    REQUIRE(queue.push(4));
+    REQUIRE(!queue.push(5));
+    REQUIRE(queue.size() == 4);
+
+    REQUIRE(queue.pop().value() == 1);
+    REQUIRE(queue.pop().value() == 2);
+    REQUIRE(queue.push(5));
+    REQUIRE(queue.pop().value() == 3);
+    REQUIRE(queue.pop().value() == 4);
+    REQUIRE(queue.pop().value() == 5);
+    REQUIRE(!queue.pop().has_value());
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("ConcurrentQueue batch push pop", "[ConcurrentQueue]") {
+    Dynamo::ConcurrentQueue<int, 4> queue;
+    int src[6] = {1, 2, 3, 4, 5, 6};
+    int dst[6] = {0, 0, 0, 0, 0, 0};
+
+    REQUIRE(queue.push(src, 3) == 3);
+    REQUIRE(queue.push(src + 3, 3) == 1);
+    REQUIRE(queue.size() == 4);
+
+    REQUIRE(queue.pop(dst, 2) == 2);
+    REQUIRE(queue.push(src + 4, 2) == 2);
+    REQUIRE(queue.pop(dst + 2, 6) == 4);
+    REQUIRE(queue.pop(dst, 1) == 0);
+
+    for (unsigned i = 0; i < 6; i++) {
+        REQUIRE(dst[i] == src[i]);
+    }
+}
+
+TEST_CASE("ConcurrentQueue multiple producers and consumers", "[ConcurrentQueue]") {
+    Dynamo::ConcurrentQueue<unsigned, 64> queue;
+    unsigned threads = 4;
+    unsigned count = 1 << 15;
+
+    unsigned long long total = threads * count;
+    unsigned long long expected = (total * (total - 1)) / 2;
+    REQUIRE(contend(queue, threads, count) == expected);
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("ConcurrentQueue contention benchmark", "[ConcurrentQueue]") {
+    unsigned threads = std::max(2U, std::thread::hardware_concurrency() / 2);
+    unsigned count = 1 << 12;
+
+    BENCHMARK("ConcurrentQueue contention benchmark") {
+        Dynamo::ConcurrentQueue<unsigned, 1024> queue;
+        return contend(queue, threads, count);
+    };
+
+    BENCHMARK("Mutex queue contention benchmark") {
+        LockedQueue queue;
+        return contend(queue, threads, count);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("DeadlineScheduler create and destroy", "[DeadlineScheduler]") {
+    {
+        Dynamo::DeadlineScheduler scheduler_0(0);
+        Dynamo::DeadlineScheduler scheduler_4(4);
+    }
+}
+
+TEST_CASE("DeadlineScheduler wait", "[DeadlineScheduler]") {
+    Dynamo::DeadlineScheduler scheduler(2);
+    auto now = Dynamo::DeadlineScheduler::Clock::now();
+
+    std::atomic<int> sum = 0;
+    std::vector<Dynamo::DeadlineScheduler::TaskRef> tasks;
+    for (int i = 1; i <= 100; i++) {
+        tasks.push_back(scheduler.submit([&sum, i]() { sum += i; }, now + std::chrono::milliseconds(i)));
+    }
+    for (auto &task : tasks) {
+        scheduler.wait(task);
+        REQUIRE(task->done());
+    }
+    REQUIRE(sum == 5050);
+}
+
+TEST_CASE("DeadlineScheduler earliest deadline", "[DeadlineScheduler]") {
+    Dynamo::DeadlineScheduler scheduler(1);
+    auto now = Dynamo::DeadlineScheduler::Clock::now();
+
+    // Block the worker so the remaining tasks are queued together
+    std::mutex gate;
+    gate.lock();
+    scheduler.submit([&gate]() { std::scoped_lock<std::mutex> lock(gate); }, now);
+
+    std::vector<int> order;
+    std::mutex order_mutex;
+    std::vector<Dynamo::DeadlineScheduler::TaskRef> tasks;
+    for (int i : {3, 1, 2}) {
+        auto job = [&order, &order_mutex, i]() {
+            std::scoped_lock<std::mutex> lock(order_mutex);
+            order.push_back(i);
+        };
+        tasks.push_back(scheduler.submit(job, now + std::chrono::seconds(i)));
+    }
+    gate.unlock();
+
+    // Poll rather than wait, so that no task is run inline
+    for (auto &task : tasks) {
+        while (!task->done()) {
+            std::this_thread::yield();
+        }
+    }
+    REQUIRE(order == std::vector<int>({1, 2, 3}));
+}
+
+TEST_CASE("DeadlineScheduler inline", "[DeadlineScheduler]") {
+    // Without workers, tasks run on the waiting thread
+    Dynamo::DeadlineScheduler scheduler(0);
+    std::thread::id id;
+    auto task = scheduler.submit([&id]() { id = std::this_thread::get_id(); },
+                                 Dynamo::DeadlineScheduler::Clock::now());
+    REQUIRE(!task->done());
+    scheduler.wait(task);
+    REQUIRE(task->done());
+    REQUIRE(id == std::this_thread::get_id());
+}
+
+TEST_CASE("DeadlineScheduler resubmit", "[DeadlineScheduler]") {
+    // Pre-allocated tasks can be submitted again once they are done
+    Dynamo::DeadlineScheduler scheduler(2);
+    int count = 0;
+    auto task = std::make_shared<Dynamo::DeadlineScheduler::Task>([&count]() { count++; });
+    REQUIRE(task->done());
+    for (int i = 0; i < 1000; i++) {
+        scheduler.submit(task, Dynamo::DeadlineScheduler::Clock::now());
+        scheduler.wait(task);
+        REQUIRE(task->done());
+    }
+    REQUIRE(count == 1000);
+}
\ No newline at end of file
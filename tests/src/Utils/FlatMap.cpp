@@ -0,0 +1,149 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using IntMap = Dynamo::FlatMap<int, int>;
+
+TEST_CASE("FlatMap emplace find", "[FlatMap]") {
+    IntMap map;
+    REQUIRE(map.empty());
+    REQUIRE(map.find(3) == map.end());
+
+    auto [a_it, a_inserted] = map.emplace(3, 30);
+    REQUIRE(a_inserted);
+    REQUIRE(a_it->first == 3);
+    REQUIRE(a_it->second == 30);
+
+    auto [b_it, b_inserted] = map.emplace(3, 40);
+    REQUIRE(!b_inserted);
+    REQUIRE(b_it->second == 30);
+
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.count(3) == 1);
+    REQUIRE(map.count(4) == 0);
+    REQUIRE(map.at(3) == 30);
+    REQUIRE_THROWS(map.at(4));
+}
+
+TEST_CASE("FlatMap subscript", "[FlatMap]") {
+    IntMap map;
+    map[1] = 10;
+    map[2] += 5;
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(map[1] == 10);
+    REQUIRE(map[2] == 5);
+
+    const IntMap &const_map = map;
+    REQUIRE(const_map.find(1)->second == 10);
+    REQUIRE(const_map.at(2) == 5);
+}
+
+TEST_CASE("FlatMap grow", "[FlatMap]") {
+    IntMap map;
+    for (int i = 0; i < 10000; i++) {
+        map.emplace(i * 7, i);
+    }
+    REQUIRE(map.size() == 10000);
+    for (int i = 0; i < 10000; i++) {
+        REQUIRE(map.at(i * 7) == i);
+        REQUIRE(map.count(i * 7 + 1) == 0);
+    }
+}
+
+TEST_CASE("FlatMap erase", "[FlatMap]") {
+    IntMap map;
+    for (int i = 0; i < 1000; i++) {
+        map.emplace(i, i);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        REQUIRE(map.erase(i) == 1);
+    }
+    REQUIRE(map.erase(0) == 0);
+    REQUIRE(map.size() == 500);
+
+    for (int i = 0; i < 1000; i++) {
+        REQUIRE(map.count(i) == static_cast<unsigned>(i % 2));
+    }
+
+    // Churn through tombstones without growing unboundedly
+    for (int i = 1000; i < 100000; i++) {
+        map.emplace(i, i);
+        map.erase(i);
+    }
+    REQUIRE(map.size() == 500);
+    for (int i = 1; i < 1000; i += 2) {
+        REQUIRE(map.at(i) == i);
+    }
+}
+
+TEST_CASE("FlatMap iterate", "[FlatMap]") {
+    Dynamo::FlatMap<std::string, int> map;
+    map.emplace("a", 1);
+    map.emplace("b", 2);
+    map.emplace("c", 3);
+    map.erase("b");
+
+    int sum = 0;
+    unsigned count = 0;
+    for (const auto &[key, value] : map) {
+        sum += value;
+        count++;
+    }
+    REQUIRE(sum == 4);
+    REQUIRE(count == map.size());
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.find("a") == map.end());
+}
+
+TEST_CASE("FlatMap copy and move", "[FlatMap]") {
+    Dynamo::FlatMap<std::string, std::string> map;
+    map.emplace("key", "value");
+
+    Dynamo::FlatMap<std::string, std::string> copy = map;
+    REQUIRE(copy.at("key") == "value");
+
+    Dynamo::FlatMap<std::string, std::string> moved = std::move(map);
+    REQUIRE(moved.at("key") == "value");
+    REQUIRE(map.empty());
+
+    std::vector<Dynamo::FlatMap<std::string, std::string>> maps;
+    for (unsigned i = 0; i < 16; i++) {
+        maps.push_back({});
+        maps.back().emplace(std::to_string(i), "value");
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        REQUIRE(maps[i].count(std::to_string(i)) == 1);
+    }
+}
+
+TEST_CASE("FlatMap benchmark", "[FlatMap]") {
+    constexpr int count = 1 << 16;
+
+    BENCHMARK("FlatMap insert and find benchmark") {
+        Dynamo::FlatMap<int, int> map;
+        int sum = 0;
+        for (int i = 0; i < count; i++) {
+            map.emplace(i * 31, i);
+        }
+        for (int i = 0; i < count; i++) {
+            sum += map.find(i * 31)->second;
+        }
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map insert and find benchmark") {
+        std::unordered_map<int, int> map;
+        int sum = 0;
+        for (int i = 0; i < count; i++) {
+            map.emplace(i * 31, i);
+        }
+        for (int i = 0; i < count; i++) {
+            sum += map.find(i * 31)->second;
+        }
+        return sum;
+    };
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <Dynamo.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <thread>
 
 TEST_CASE("RingBuffer write", "[RingBuffer]") {
     Dynamo::RingBuffer<short, 4> buffer;
@@ -179,3 +180,68 @@ TEST_CASE("RingBuffer clear", "[RingBuffer]") {
     REQUIRE(buffer.size() == 0);
     REQUIRE(buffer.empty());
 }
+
+TEST_CASE("RingBuffer regions", "[RingBuffer]") {
+    Dynamo::RingBuffer<short, 4> buffer;
+    buffer.write(1);
+    buffer.write(2);
+    buffer.write(3);
+    buffer.read();
+    buffer.read();
+
+    // Writable space wraps around the end of the buffer
+    auto w_regions = buffer.acquire_write(4);
+    REQUIRE(w_regions[0].length == 1);
+    REQUIRE(w_regions[1].length == 2);
+    w_regions[0].data[0] = 4;
+    w_regions[1].data[0] = 5;
+    w_regions[1].data[1] = 6;
+    buffer.commit_write(3);
+    REQUIRE(buffer.full());
+
+    // Readable data wraps around the end of the buffer
+    auto r_regions = buffer.acquire_read(4);
+    REQUIRE(r_regions[0].length == 2);
+    REQUIRE(r_regions[1].length == 2);
+    REQUIRE(r_regions[0].data[0] == 3);
+    REQUIRE(r_regions[0].data[1] == 4);
+    REQUIRE(r_regions[1].data[0] == 5);
+    REQUIRE(r_regions[1].data[1] == 6);
+    REQUIRE(buffer.size() == 4);
+
+    buffer.commit_read(3);
+    REQUIRE(buffer.size() == 1);
+    REQUIRE(buffer.read() == 6);
+    CHECK_THROWS(buffer.commit_read(1));
+}
+
+TEST_CASE("RingBuffer concurrent producer consumer", "[RingBuffer]") {
+    Dynamo::RingBuffer<unsigned, 64> buffer;
+    constexpr unsigned count = 1 << 16;
+
+    std::thread producer([&]() {
+        unsigned values[7];
+        unsigned next = 0;
+        while (next < count) {
+            unsigned n = std::min(7U, count - next);
+            for (unsigned i = 0; i < n; i++) {
+                values[i] = next + i;
+            }
+            next += buffer.write(values, n);
+        }
+    });
+
+    unsigned expected = 0;
+    bool ordered = true;
+    unsigned values[5];
+    while (expected < count) {
+        unsigned n = buffer.read(values, 5);
+        for (unsigned i = 0; i < n; i++) {
+            ordered &= values[i] == expected++;
+        }
+    }
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(buffer.empty());
+}
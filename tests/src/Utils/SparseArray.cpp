@@ -124,4 +124,44 @@ TEST_CASE("SparseArray foreach", "[SparseArray]") {
     REQUIRE(items[2] == 'c');
 
     REQUIRE(items.size() == set.size());
+}
+
+TEST_CASE("SparseArray stale handle", "[SparseArray]") {
+    CharArray set;
+
+    Id a = set.insert('a');
+    set.remove(a);
+
+    // The recycled slot must not be reachable from the stale handle
+    Id b = set.insert('b');
+    REQUIRE(a != b);
+    REQUIRE(!set.exists(a));
+    REQUIRE(set.exists(b));
+    REQUIRE(set.get(b) == 'b');
+    REQUIRE_THROWS(set.get(a));
+    REQUIRE_THROWS(set.remove(a));
+    REQUIRE(set.size() == 1);
+}
+
+TEST_CASE("SparseArray foreach after remove", "[SparseArray]") {
+    CharArray set;
+
+    std::vector<Id> ids;
+    for (char c = 'a'; c <= 'z'; c++) {
+        ids.push_back(set.insert(c));
+    }
+    for (unsigned i = 0; i < ids.size(); i++) {
+        if (i % 3) set.remove(ids[i]);
+    }
+
+    std::vector<char> items;
+    set.foreach ([&](char &item) { items.push_back(item); });
+    std::sort(items.begin(), items.end());
+
+    REQUIRE(items.size() == set.size());
+    for (unsigned i = 0; i < items.size(); i++) {
+        char expected = 'a' + i * 3;
+        REQUIRE(items[i] == expected);
+        REQUIRE(set.get(ids[i * 3]) == expected);
+    }
 }
\ No newline at end of file
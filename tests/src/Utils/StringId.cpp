@@ -0,0 +1,50 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Dynamo;
+
+TEST_CASE("StringId compile-time", "[StringId]") {
+    constexpr StringId a = "transform"_sid;
+    constexpr StringId b("transform");
+    static_assert(a == b);
+    static_assert(a != "texsampler"_sid);
+
+    std::string name = "transform";
+    REQUIRE(StringId(name) == a);
+    REQUIRE(StringId(name).value() == a.value());
+}
+
+TEST_CASE("StringId empty", "[StringId]") {
+    REQUIRE(StringId("") == ""_sid);
+    REQUIRE(StringId("") != StringId());
+}
+
+TEST_CASE("StringId intern", "[StringId]") {
+    StringId a = StringId::intern("cubemap");
+    StringId b = StringId::intern(std::string("cubemap"));
+
+    REQUIRE(a == b);
+    REQUIRE(a == "cubemap"_sid);
+    REQUIRE(a.str() == "cubemap");
+    REQUIRE("not_interned"_sid.str().empty());
+}
+
+TEST_CASE("StringId str stable", "[StringId]") {
+    const std::string &first = StringId::intern("stable0").str();
+    for (unsigned i = 1; i < 4096; i++) {
+        StringId::intern("stable" + std::to_string(i));
+    }
+    REQUIRE(first == "stable0");
+    REQUIRE(&first == &"stable0"_sid.str());
+}
+
+TEST_CASE("StringId map key", "[StringId]") {
+    FlatMap<StringId, unsigned> map;
+    for (unsigned i = 0; i < 1000; i++) {
+        map.emplace(StringId::intern("uniform" + std::to_string(i)), i);
+    }
+    REQUIRE(map.size() == 1000);
+    REQUIRE(map.at("uniform0"_sid) == 0);
+    REQUIRE(map.at("uniform999"_sid) == 999);
+    REQUIRE(map.count("uniform1000"_sid) == 0);
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+TEST_CASE("TripleBuffer publish acquire", "[TripleBuffer]") {
+    Dynamo::TripleBuffer<int> buffer;
+    REQUIRE(!buffer.acquire());
+
+    buffer.back() = 1;
+    buffer.publish();
+    REQUIRE(buffer.acquire());
+    REQUIRE(buffer.front() == 1);
+    REQUIRE(!buffer.acquire());
+    REQUIRE(buffer.front() == 1);
+}
+
+TEST_CASE("TripleBuffer latest snapshot", "[TripleBuffer]") {
+    Dynamo::TripleBuffer<int> buffer;
+    for (int i = 0; i < 5; i++) {
+        buffer.back() = i;
+        buffer.publish();
+    }
+    REQUIRE(buffer.acquire());
+    REQUIRE(buffer.front() == 4);
+}
+
+TEST_CASE("TripleBuffer concurrent writer reader", "[TripleBuffer]") {
+    struct Snapshot {
+        unsigned a;
+        unsigned b;
+    };
+    Dynamo::TripleBuffer<Snapshot> buffer;
+    buffer.back() = {0, 0};
+    buffer.publish();
+
+    constexpr unsigned count = 100000;
+    std::thread writer([&]() {
+        for (unsigned i = 1; i <= count; i++) {
+            buffer.back() = {i, i * 2};
+            buffer.publish();
+        }
+    });
+
+    // Snapshots are never torn and never go back in time
+    unsigned last = 0;
+    bool consistent = true;
+    while (last < count) {
+        buffer.acquire();
+        const Snapshot &snapshot = buffer.front();
+        consistent &= snapshot.b == snapshot.a * 2 && snapshot.a >= last;
+        last = snapshot.a;
+    }
+    writer.join();
+    REQUIRE(consistent);
+}
\ No newline at end of file